@@ -2,13 +2,36 @@
 // @author     Jose A. Romero (jromero132)
 // @algorithm  AVL Tree (Self-Balancing Binary Search Tree)
 // @docs       A unique-key BST supporting order statistics (0/1-indexed kth
-//             element and order_of_key lower-bound indexing).
-// @time       $O(\log N)$ insertion, deletion, and retrieval; $O(N)$ traversal
-// @space      $O(N)$
+//             element and order_of_key lower-bound indexing). Nodes come from
+//             a chunked pool shared by every `avl<T>` (so trees can exchange
+//             nodes) and share one `null` sentinel; erased and destroyed
+//             nodes go back to the pool's free list for reuse. The pool is
+//             not thread-safe: only one thread may insert or erase at a time.
+//             Insert and erase are iterative: they record the search path and
+//             rebalance bottom-up only until a subtree keeps its height, then
+//             just fix the sizes above it. Bidirectional iterators (`begin`,
+//             `lower_bound`, `range(lo, hi)`) carry their root-to-node path
+//             inline and `for_each_in_order` streams keys, so traversal
+//             allocates nothing. Range constructors bulk-load a perfectly
+//             balanced tree in O(N) from strictly increasing input (other
+//             input is sorted first). `join(left, key, right)` and
+//             `split(key)` reuse the existing nodes, and so do the set
+//             operations built on them (`set_union`, `set_intersection`,
+//             `set_difference`). Those fork onto up to `threads` threads and
+//             free dropped nodes in the calling thread once the workers join.
+// @time       $O(\log N)$ insertion, deletion, retrieval, `lower_bound`, join
+//             and split; $O(m \log(n / m + 1))$ set operations (m <= n);
+//             $O(N)$ traversal, sorted bulk load and `clear()`; $O(1)$
+//             amortized iterator step
+// @space      $O(N)$, chunks are kept for reuse until the program exits
 // =============================================================================
 
 #include <algorithm>
 #include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <system_error>
+#include <thread>
 #include <vector>
 
 template <typename T>
@@ -27,8 +50,53 @@ struct avl {
   } *root, *null;
 
   private:
+  static const int MAX_HEIGHT = 64;  // An AVL tree of 2^31 nodes is at most 45 levels deep
+  static const int MIN_PARALLEL_WORK = 1 << 15;  // Smaller set operations stay on one thread
+
+  // Hands out nodes from chunks of CHUNK, recycling released ones first. Once every node is
+  // back (e.g. all trees cleared) it restarts from the first chunk, in address order again.
+  struct node_pool {
+    static const int CHUNK = 1 << 12;
+    std::vector<node*> chunks, free_nodes;
+    int next = 0, used = CHUNK;  // Bump position: chunk and slot inside it
+    long long live = 0;
+
+    ~node_pool() {
+      for (node* c : chunks) delete[] c;
+    }
+
+    node* get() {
+      ++live;
+      if (!free_nodes.empty()) {
+        node* u = free_nodes.back();
+        free_nodes.pop_back();
+        return u;
+      }
+      if (used == CHUNK) {
+        if (next == static_cast<int>(chunks.size())) chunks.push_back(new node[CHUNK]);
+        ++next, used = 0;
+      }
+      return &chunks[next - 1][used++];
+    }
+
+    void release(node* u) {
+      if (--live == 0) free_nodes.clear(), next = 0, used = CHUNK;
+      else free_nodes.push_back(u);
+    }
+  };
+
+  static node_pool& pool() {
+    static node_pool p;
+    return p;
+  }
+
+  static node* sentinel() {
+    static node s{T(), 0, 0, {nullptr, nullptr}};
+    return &s;
+  }
+
   node* new_node(const T& key) const {
-    node* u = new node();
+    node* u = pool().get();
     u->key = key;
     u->h = u->sz = 1;
     u->ch[0] = u->ch[1] = null;
@@ -52,12 +120,12 @@ struct avl {
     u->update();
 
     if (u->bf() > 1) {
-      if (u->ch[1]->bf() <= 0) {  // Rotate right on right child
+      if (u->ch[1]->bf() < 0) {  // Rotate right on right child
         u->ch[1] = rotate(u->ch[1], 1);
       }
       u = rotate(u, 0);  // Rotate left
     } else if (u->bf() < -1) {
-      if (u->ch[0]->bf() >= 0) {  // Rotate left on left child
+      if (u->ch[0]->bf() > 0) {  // Rotate left on left child
         u->ch[0] = rotate(u->ch[0], 0);
       }
       u = rotate(u, 1);  // Rotate right;
@@ -67,65 +135,267 @@ struct avl {
     return u;
   }
 
-  node* insert(node* u, const T& key) {
-    if (u == null) return u = new_node(key);
-    if (u->key == key) return u;
+  // Rebalances path[k - 1], ..., path[0] around the new child subtree `sub` of path[k - 1],
+  // stopping once a subtree keeps its height: above it only the sizes change by `delta`.
+  // Returns the new top of the path.
+  node* fix_path(node* const* path, const bool* dir, int k, node* sub, int delta) {
+    while (k > 0) {
+      node* u = path[--k];
+      const int h = u->h;
+      u->ch[dir[k]] = sub;
+      sub = balance(u);
+      if (sub->h == h) break;
+    }
+    if (k == 0) return sub;
+    path[k - 1]->ch[dir[k - 1]] = sub;
+    while (k > 0) path[--k]->sz += delta;
+    return path[0];
+  }
 
-    bool d = (key > u->key);
-    u->ch[d] = insert(u->ch[d], key);
-    return u = balance(u);
+  // Builds a perfectly balanced tree from the next n keys of `it` (increasing), in order
+  template <typename Iter>
+  node* build(Iter& it, int n) {
+    if (n == 0) return null;
+    node* l = build(it, n / 2);
+    node* u = new_node(*it);
+    ++it;
+    u->ch[0] = l;
+    u->ch[1] = build(it, n - n / 2 - 1);
+    u->update();
+    return u;
   }
 
-  node* erase(node* u, T key) {
-    if (u == null) return u;
+  // Single-pass input is buffered, since the forward version reads the range twice
+  template <typename Iter>
+  node* build(Iter first, Iter last, std::input_iterator_tag) {
+    const std::vector<T> keys(first, last);
+    return build(keys.begin(), keys.end(), std::forward_iterator_tag());
+  }
 
-    T tmp = u->key;
+  template <typename Iter>
+  node* build(Iter first, Iter last, std::forward_iterator_tag) {
+    if (std::adjacent_find(first, last, [](const T& a, const T& b) { return !(b > a); }) == last) {
+      return build(first, std::distance(first, last));
+    }
+    std::vector<T> keys(first, last);
+    std::sort(keys.begin(), keys.end());
+    keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+    typename std::vector<T>::const_iterator it = keys.begin();
+    return build(it, keys.size());
+  }
+
+  // Hangs l and r (keys of l < m->key < keys of r) under m: m goes down the spine of the
+  // taller tree facing the other one until the heights are close, then rebalances up
+  node* join(node* l, node* m, node* r) {
+    node* path[MAX_HEIGHT];
+    bool dir[MAX_HEIGHT];
+    int k = 0;
+    const bool d = l->h < r->h;
+    node* other = d ? l : r;
+    node* u = d ? r : l;
+    for (; u->h > other->h + 1; u = u->ch[!d]) path[k] = u, dir[k++] = !d;
+    m->ch[d] = u;
+    m->ch[!d] = other;
+    m->update();
+    return fix_path(path, dir, k, m, other->sz + 1);
+  }
+
+  // Splits u into the keys below `key` (l) and above it (r); mid is the node holding `key`,
+  // or null. Every node on the search path is reused as a join key.
+  void split(node* u, const T& key, node*& l, node*& mid, node*& r) {
+    if (u == null) {
+      l = mid = r = null;
+      return;
+    }
+    node *a = u->ch[0], *b = u->ch[1];
     if (u->key == key) {
-      if (u->ch[0] == null || u->ch[1] == null) {
-        return u->ch[u->ch[0] == null];
+      l = a, mid = u, r = b;
+    } else if (key > u->key) {
+      split(b, key, b, mid, r);
+      l = join(a, u, b);
+    } else {
+      split(a, key, l, mid, a);
+      r = join(a, u, b);
+    }
+  }
+
+  // Joins l and r (keys of l < keys of r) using the minimum of r as the middle node
+  node* join(node* l, node* r) {
+    if (r == null) return l;
+    node* path[MAX_HEIGHT];
+    bool dir[MAX_HEIGHT];
+    int k = 0;
+    node* m = r;
+    for (; m->ch[0] != null; m = m->ch[0]) path[k] = m, dir[k++] = 0;
+    r = fix_path(path, dir, k, m->ch[1], -1);
+    return join(l, m, r);
+  }
+
+  // Returns every node of u's subtree to the pool; rotates left children up instead of using
+  // a stack
+  void release_subtree(node* u) {
+    while (u != null) {
+      if (u->ch[0] != null) {
+        node* l = u->ch[0];
+        u->ch[0] = l->ch[1];
+        l->ch[1] = u;
+        u = l;
       } else {
-        node* t = u->ch[0];
-        while (t->ch[1] != null) {
-          t = t->ch[1];
-        }
-        key = u->key = t->key;
+        node* next = u->ch[1];
+        pool().release(u);
+        u = next;
       }
     }
+  }
+
+  enum set_op { UNION, INTERSECTION, DIFFERENCE };
+
+  // Returns op(a, b), consuming both: splits b by a's root, solves both sides (the left one on
+  // a new thread while the budget allows) and joins them back, with or without a's root.
+  // Dropped subtrees are only collected in `dead`, so worker threads never touch the pool.
+  node* combine(node* a, node* b, set_op op, int threads, std::vector<node*>& dead) {
+    if (a == null || b == null) {
+      if (op != UNION && b != null) dead.push_back(b);
+      if (op == INTERSECTION && a != null) dead.push_back(a);
+      return op == UNION && a == null ? b : op == INTERSECTION ? null : a;
+    }
+
+    const bool fork = threads > 1 && a->sz + b->sz >= MIN_PARALLEL_WORK;
+    node *l, *mid, *r, *la = a->ch[0], *ra = a->ch[1];
+    split(b, a->key, l, mid, r);
+    std::vector<node*> dead_left;
+    std::thread left;
+    if (fork) {
+      try {
+        left = std::thread([&] { l = combine(la, l, op, threads / 2, dead_left); });
+      } catch (const std::system_error&) {  // The OS refused a thread: finish serially
+      }
+    }
+    if (left.joinable()) {
+      r = combine(ra, r, op, threads - threads / 2, dead);
+      left.join();
+      dead.insert(dead.end(), dead_left.begin(), dead_left.end());
+    } else {
+      l = combine(la, l, op, 1, dead);
+      r = combine(ra, r, op, 1, dead);
+    }
 
-    bool d = (key > tmp);
-    u->ch[d] = erase(u->ch[d], key);
-    return u = balance(u);
+    const bool keep_root = op == UNION || (op == INTERSECTION) == (mid != null);
+    if (mid != null) dead.push_back(detach(mid));
+    if (keep_root) return join(l, a, r);
+    dead.push_back(detach(a));
+    return join(l, r);
   }
 
-  std::vector<T> in_order(const node* u) const {
-    if (u == null) return {};
+  node* detach(node* u) const {
+    u->ch[0] = u->ch[1] = null;
+    return u;
+  }
 
-    std::vector<T> order = in_order(u->ch[0]);
-    order.push_back(u->key);
-    std::vector<T> right = in_order(u->ch[1]);
-    order.insert(order.end(), right.begin(), right.end());
-    return order;
+  static avl combine(avl& a, avl& b, set_op op, int threads) {
+    assert(&a != &b);
+    avl res;
+    std::vector<node*> dead;
+    res.root = res.combine(a.root, b.root, op, threads, dead);
+    a.root = b.root = res.null;
+    for (node* u : dead) res.release_subtree(u);
+    return res;
   }
 
   public:
-  avl() {
-    null = new node();
-    null->h = null->sz = 0;
-    null->ch[0] = null->ch[1] = 0;
-    root = null;
-  }
+  avl() : root(sentinel()), null(root) { pool(); }  // Pool outlives global trees
+
+  avl(const avl&) = delete;
+  avl& operator=(const avl&) = delete;
 
-  avl(std::vector<T> initial_values) : avl() {
-    for (auto v : initial_values) insert(v);
+  avl(avl&& o) : avl() { std::swap(root, o.root); }
+  avl& operator=(avl&& o) {
+    std::swap(root, o.root);
+    return *this;
   }
 
+  ~avl() { clear(); }
+
+  avl(const std::vector<T>& initial_values) : avl(initial_values.begin(), initial_values.end()) {}
+
+  // O(N) from a strictly increasing range; anything else is sorted and deduplicated first
   template <typename Iter>
   avl(Iter first, Iter last) : avl() {
-    for (auto it = first; it != last; ++it) insert(*it);
+    root = build(first, last, typename std::iterator_traits<Iter>::iterator_category());
   }
 
-  void insert(const T& key) { root = insert(root, key); }
-  void erase(T key) { root = erase(root, key); }
+  // Returns the union of left, key and right, which must satisfy left < key < right; both are
+  // left empty
+  static avl join(avl&& left, const T& key, avl&& right) {
+    assert(left.size() == 0 || key > *--left.end());
+    assert(right.size() == 0 || *right.begin() > key);
+    avl res;
+    res.root = res.join(left.root, res.new_node(key), right.root);
+    left.root = right.root = res.null;
+    return res;
+  }
+
+  // Set operations on two trees, which are consumed (left empty). Work is
+  // O(m log(n / m + 1)) for sizes m <= n; the recursion forks onto up to `threads` threads.
+  static avl set_union(avl&& a, avl&& b, int threads = 1) {
+    return combine(a, b, UNION, threads);
+  }
+  static avl set_intersection(avl&& a, avl&& b, int threads = 1) {
+    return combine(a, b, INTERSECTION, threads);
+  }
+  static avl set_difference(avl&& a, avl&& b, int threads = 1) {
+    return combine(a, b, DIFFERENCE, threads);
+  }
+
+  // Keeps the keys less than `key` and returns a tree with the rest
+  avl split(const T& key) {
+    node *l, *mid, *r;
+    split(root, key, l, mid, r);
+    avl res;
+    root = l;
+    res.root = mid == null ? r : join(null, mid, r);
+    return res;
+  }
+
+  void insert(const T& key) {
+    node* path[MAX_HEIGHT];
+    bool dir[MAX_HEIGHT];
+    int k = 0;
+    for (node* u = root; u != null; u = u->ch[dir[k++]]) {
+      if (u->key == key) return;
+      path[k] = u, dir[k] = key > u->key;
+    }
+    root = fix_path(path, dir, k, new_node(key), 1);
+  }
+
+  void erase(const T& key) {
+    node* path[MAX_HEIGHT];
+    bool dir[MAX_HEIGHT];
+    int k = 0;
+    node* u = root;
+    for (; u != null && u->key != key; u = u->ch[dir[k++]]) path[k] = u, dir[k] = key > u->key;
+    if (u == null) return;
+
+    if (u->ch[0] != null && u->ch[1] != null) {  // Move the predecessor up and unlink it instead
+      node* t = u->ch[0];
+      path[k] = u, dir[k++] = 0;
+      for (; t->ch[1] != null; t = t->ch[1]) path[k] = t, dir[k++] = 1;
+      u->key = t->key;
+      u = t;
+    }
+
+    node* child = u->ch[u->ch[0] == null];
+    pool().release(u);
+    root = fix_path(path, dir, k, child, -1);
+  }
+
+  int size() const { return root->sz; }
+
+  // Returns every node to the pool
+  void clear() {
+    release_subtree(root);
+    root = null;
+  }
 
   bool find(const T& key) const {
     node* u = root;
@@ -165,8 +435,126 @@ struct avl {
     return u->key;
   }
 
+  // Calls f(key) on every key in increasing order, without recursion or allocation
+  template <typename F>
+  void for_each_in_order(F f) const {
+    const node* path[MAX_HEIGHT];
+    int k = 0;
+    for (const node* u = root;; u = u->ch[1]) {
+      for (; u != null; u = u->ch[0]) path[k++] = u;
+      if (k == 0) return;
+      u = path[--k];
+      f(u->key);
+    }
+  }
+
   // Returns the elements in sorted order
-  std::vector<T> in_order() const { return in_order(root); }
+  std::vector<T> in_order() const {
+    std::vector<T> order;
+    order.reserve(size());
+    for_each_in_order([&order](const T& key) { order.push_back(key); });
+    return order;
+  }
+
+  // Bidirectional, read-only; keeps its root-to-node path inline, so it never allocates.
+  // Any insert or erase on the tree invalidates it.
+  class iterator {
+    public:
+    typedef std::bidirectional_iterator_tag iterator_category;
+    typedef T value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef const T* pointer;
+    typedef const T& reference;
+
+    iterator() : tree(nullptr), k(0) {}
+
+    const T& operator*() const { return path[k - 1]->key; }
+    const T* operator->() const { return &path[k - 1]->key; }
+
+    iterator& operator++() {
+      step(1);
+      return *this;
+    }
+    iterator& operator--() {
+      step(0);
+      return *this;
+    }
+    iterator operator++(int) {
+      iterator it = *this;
+      step(1);
+      return it;
+    }
+    iterator operator--(int) {
+      iterator it = *this;
+      step(0);
+      return it;
+    }
+
+    bool operator==(const iterator& o) const {
+      return k == o.k && (k == 0 || path[k - 1] == o.path[k - 1]);
+    }
+    bool operator!=(const iterator& o) const { return !(*this == o); }
+
+    private:
+    friend struct avl;
+
+    const avl* tree;
+    const node* path[MAX_HEIGHT];
+    int k;  // Path length; 0 is end()
+
+    explicit iterator(const avl* t) : tree(t), k(0) {}
+
+    void descend(const node* u, bool d) {
+      for (; u != tree->null; u = u->ch[d]) path[k++] = u;
+    }
+
+    // Moves to the next key (d = 1) or the previous one (d = 0); end() steps back to the maximum
+    void step(bool d) {
+      if (k == 0) {
+        descend(tree->root, 1);
+      } else if (path[k - 1]->ch[d] != tree->null) {
+        descend(path[k - 1]->ch[d], !d);
+      } else {
+        const node* u;
+        do u = path[--k];
+        while (k > 0 && path[k - 1]->ch[d] == u);
+      }
+    }
+  };
+
+  typedef iterator const_iterator;
+
+  // Iterators over [first, last), usable in range-based for loops
+  struct key_range {
+    iterator first, last;
+    iterator begin() const { return first; }
+    iterator end() const { return last; }
+  };
+
+  iterator begin() const {
+    iterator it(this);
+    it.descend(root, 0);
+    return it;
+  }
+
+  iterator end() const { return iterator(this); }
+
+  // Returns an iterator to the first key not less than `key`
+  iterator lower_bound(const T& key) const {
+    iterator it(this);
+    int keep = 0;
+    for (const node* u = root; u != null; u = u->ch[!(key <= u->key)]) {
+      it.path[it.k++] = u;
+      if (key <= u->key) keep = it.k;
+    }
+    it.k = keep;
+    return it;
+  }
+
+  // Keys in [lo, hi) (lo <= hi), in increasing order
+  key_range range(const T& lo, const T& hi) const {
+    return key_range{lower_bound(lo), lower_bound(hi)};
+  }
 };
 
 #ifdef LOCAL
@@ -191,6 +579,21 @@ int main() {
 
   cout << "Element at rank 1 (0-indexed): " << tree.kth(1, 0);
   cout << " (Expected: 10)" << endl;
+
+  cout << "Keys in [6, 20):";
+  int found = 0;
+  for (int x : tree.range(6, 20)) {
+    cout << " " << x;
+    found += x == 10 ? 1 : 100;
+  }
+  cout << " (Expected: 10)" << (found != 1 ? " [ERROR]" : "") << endl;
+
+  avl<int> odds(vector<int>{1, 3, 5, 7}), low(vector<int>{1, 2, 3});
+  avl<int> both = avl<int>::set_union(std::move(odds), std::move(low), 2);
+  cout << "Union of {1, 3, 5, 7} and {1, 2, 3}:";
+  for (int x : both) cout << " " << x;
+  const bool ok = both.in_order() == vector<int>{1, 2, 3, 5, 7};
+  cout << " (Expected: 1 2 3 5 7)" << (!ok ? " [ERROR]" : "") << endl;
   return 0;
 }
 #endif
@@ -0,0 +1,108 @@
+// =============================================================================
+// @author     Jose A. Romero (jromero132)
+// @algorithm  Blocked Bloom Filter (Cache-Line Blocks)
+// @docs       Approximate membership filter sized from the expected number of
+//             keys and a target false-positive rate. All k bits of a key live
+//             in one 512-bit block aligned to a cache line, so both insert and
+//             query touch a single line. Never reports a false negative; put
+//             it in front of `hash_table::find` to skip chain walks on the
+//             (filtered) misses of negative-heavy workloads. Below p = 0.01
+//             the blocked layout overshoots the target rate by about 2x.
+// @time       $O(k)$ per operation, one cache miss
+// @space      ~$1.1 \cdot 1.44 \log_2(1/p)$ bits per expected key
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+template <typename H, typename Hash = std::hash<H>>
+struct bloom_filter {
+  public:
+  bloom_filter(int expected, double fp_rate = 0.01, const Hash& hasher = Hash()) : hasher(hasher) {
+    const double bits_per_key = -std::log(fp_rate) / (std::log(2.0) * std::log(2.0));
+    k = std::max(1, static_cast<int>(std::round(bits_per_key * std::log(2.0))));
+    // Blocking skews per-block load; 10% extra bits brings p >= 0.01 back to the target
+    blocks = std::max(1LL, static_cast<long long>(1.1 * bits_per_key * expected) / BLOCK_BITS + 1);
+    words.assign(blocks * WORDS + WORDS - 1, 0);
+    const size_t misalign = reinterpret_cast<uintptr_t>(words.data()) / sizeof(uint64_t) % WORDS;
+    offset = misalign ? WORDS - misalign : 0;
+  }
+
+  void insert(const H& key) {
+    const uint64_t h = mix(hasher(key));
+    uint64_t* block = &words[block_of(h)];
+    for (uint32_t i = 0, a = h, b = step(h); i < static_cast<uint32_t>(k); ++i, a += b) {
+      block[(a & 511) >> 6] |= 1ULL << (a & 63);
+    }
+  }
+
+  // Returns false only if `key` was never inserted
+  bool may_contain(const H& key) const {
+    const uint64_t h = mix(hasher(key));
+    const uint64_t* block = &words[block_of(h)];
+    for (uint32_t i = 0, a = h, b = step(h); i < static_cast<uint32_t>(k); ++i, a += b) {
+      if (!(block[(a & 511) >> 6] >> (a & 63) & 1)) return false;
+    }
+    return true;
+  }
+
+  void clear() { std::fill(words.begin(), words.end(), 0); }
+
+  int hash_count() const { return k; }
+
+  private:
+  static const int BLOCK_BITS = 512, WORDS = BLOCK_BITS / 64;
+
+  Hash hasher;
+  int k;
+  long long blocks;
+  size_t offset;  // First word of the cache-line-aligned region
+  std::vector<uint64_t> words;
+
+  static inline uint64_t mix(uint64_t x) {
+    x += 0x9e3779b97f4a7c15ULL;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    return x ^ (x >> 31);
+  }
+
+  // High 64 bits of the 128-bit product x * y, from 32-bit halves (portable C++11)
+  static inline uint64_t mul_high(uint64_t x, uint64_t y) {
+    const uint64_t x0 = x & 0xffffffffULL, x1 = x >> 32, y0 = y & 0xffffffffULL, y1 = y >> 32;
+    const uint64_t cross = (x0 * y0 >> 32) + (x0 * y1 & 0xffffffffULL) + x1 * y0;
+    return x1 * y1 + (x0 * y1 >> 32) + (cross >> 32);
+  }
+
+  // High bits pick the block; probes walk a + i * b over its 512 bits (odd b keeps them distinct)
+  inline size_t block_of(uint64_t h) const {
+    return offset + WORDS * static_cast<size_t>(mul_high(h, blocks));
+  }
+  static inline uint32_t step(uint64_t h) { return ((h * 0x9e3779b97f4a7c15ULL) >> 32) | 1; }
+};
+
+#ifdef LOCAL
+#include <iostream>
+using namespace std;
+
+int main() {
+  const int n = 100000;
+  bloom_filter<int> bf(n, 0.01);
+  for (int i = 0; i < n; ++i) bf.insert(2 * i);
+
+  int false_negatives = 0, false_positives = 0;
+  for (int i = 0; i < n; ++i) {
+    false_negatives += !bf.may_contain(2 * i);
+    false_positives += bf.may_contain(2 * i + 1);
+  }
+  cout << "Hash functions: " << bf.hash_count() << endl;
+  cout << "False negatives? Expected: 0 | Found: " << false_negatives;
+  cout << (false_negatives ? " [ERROR]" : "") << endl;
+  cout << "False-positive rate? Expected: ~0.01 | Found: " << 1.0 * false_positives / n;
+  cout << (false_positives > 2 * n / 100 ? " [ERROR]" : "") << endl;
+  return 0;
+}
+#endif
@@ -0,0 +1,117 @@
+// =============================================================================
+// @author     Jose A. Romero (jromero132)
+// @algorithm  Cartesian Tree (Linear-Time Build)
+// @docs       Min-Cartesian tree of a 0-based array under `Compare`, as
+//             `parent`, `left` and `right` index arrays (-1 = none) plus
+//             `root`. Uses the same monotonic stack as `rmq_direct`'s block
+//             pass, but the stack is the right spine itself, walked through
+//             `parent`, so the build allocates nothing beyond the three
+//             arrays. Ties keep the leftmost element higher, so the root of
+//             every subtree is what `rmq_direct` returns for its range.
+//             `preorder` / `postorder` visit (v, lo, hi), where [lo, hi) is
+//             the range v is the minimum of, with a heap-allocated stack:
+//             divide and conquer on minima without recursion.
+// @time       Build: $O(N)$, Traversal: $O(N)$
+// @space      $O(N)$
+// =============================================================================
+
+#include <functional>
+#include <iterator>
+#include <vector>
+
+struct cartesian_tree {  // 0-based
+  int root;
+  std::vector<int> parent, left, right;
+
+  cartesian_tree() : root(-1) {}
+
+  template <typename Iter,
+            typename Compare = std::less<typename std::iterator_traits<Iter>::value_type>>
+  cartesian_tree(Iter first, Iter last, const Compare& comp = Compare())
+      : root(-1), parent(std::distance(first, last)), left(parent.size()), right(parent.size()) {
+    const int n = parent.size();
+    for (int i = 0; i < n; ++i) {
+      int cur = i - 1, popped = -1;  // cur walks down the right spine: the stack
+      while (cur != -1 && comp(first[i], first[cur])) popped = cur, cur = parent[cur];
+      parent[i] = cur;
+      left[i] = popped;
+      right[i] = -1;
+      if (popped != -1) parent[popped] = i;
+      if (cur != -1) right[cur] = i;
+      else root = i;
+    }
+  }
+
+  int size() const { return parent.size(); }
+
+  // Calls f(v, lo, hi) on every node before its children
+  template <typename F>
+  void preorder(F f) const {
+    std::vector<frame> stk;
+    if (root != -1) stk.push_back(frame{root, 0, size(), false});
+    while (!stk.empty()) {
+      const frame t = stk.back();
+      stk.pop_back();
+      f(t.v, t.lo, t.hi);
+      push_children(stk, t);
+    }
+  }
+
+  // Calls f(v, lo, hi) on every node after its children
+  template <typename F>
+  void postorder(F f) const {
+    std::vector<frame> stk;
+    if (root != -1) stk.push_back(frame{root, 0, size(), false});
+    while (!stk.empty()) {
+      frame& t = stk.back();
+      if (t.expanded) {
+        f(t.v, t.lo, t.hi);
+        stk.pop_back();
+        continue;
+      }
+      t.expanded = true;
+      push_children(stk, frame(t));
+    }
+  }
+
+  private:
+  struct frame {
+    int v, lo, hi;
+    bool expanded;
+  };
+
+  // Pushes right then left, so the left subtree is visited first
+  void push_children(std::vector<frame>& stk, const frame& t) const {
+    if (right[t.v] != -1) stk.push_back(frame{right[t.v], t.v + 1, t.hi, false});
+    if (left[t.v] != -1) stk.push_back(frame{left[t.v], t.lo, t.v, false});
+  }
+};
+
+#ifdef LOCAL
+#include <iostream>
+using namespace std;
+
+int main() {
+  vector<int> a = {4, 1, 8, 2, 9, 0, 3};
+  cartesian_tree ct(a.begin(), a.end());
+
+  vector<int> expected_parent = {1, 5, 3, 1, 3, -1, 5};
+  cout << "Root: " << ct.root << " (Expected: 5)" << (ct.root != 5 ? " [ERROR]" : "") << endl;
+  for (int i = 0; i < a.size(); ++i) {
+    cout << "parent[" << i << "] = " << ct.parent[i] << " (Expected: " << expected_parent[i] << ")";
+    if (ct.parent[i] != expected_parent[i]) cout << " [ERROR]";
+    cout << endl;
+  }
+
+  // Every node is the minimum of its [lo, hi)
+  ct.preorder([&](int v, int lo, int hi) {
+    int min_idx = lo;
+    for (int j = lo + 1; j < hi; ++j) min_idx = a[j] < a[min_idx] ? j : min_idx;
+    cout << "Node " << v << " covers [" << lo << ", " << hi << ")";
+    cout << " (Expected minimum at: " << min_idx << ")";
+    if (v != min_idx) cout << " [ERROR]";
+    cout << endl;
+  });
+  return 0;
+}
+#endif
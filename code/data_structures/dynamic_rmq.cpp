@@ -0,0 +1,98 @@
+// =============================================================================
+// @author     Jose A. Romero (jromero132)
+// @algorithm  Dynamic Range Minimum Query (Bottom-Up Segment Tree)
+// @docs       Point-update counterpart of `rmq_direct` with the same 0-based,
+//             half-open [l, r) argmin queries and `Compare` template; ties go
+//             to the leftmost position. Non-recursive: every operation is a
+//             leaf-to-root walk. Each node stores (value, position) so
+//             queries never chase back into the array, and siblings 2i and
+//             2i+1 sit next to each other in a power-of-two layout.
+// @time       Preprocessing: $O(N)$, Query/Update: $O(\log N)$
+// @space      $O(N)$
+// =============================================================================
+
+#include <functional>
+#include <iterator>
+#include <vector>
+
+template <typename T, typename Compare = std::less<T>>
+struct dynamic_rmq {  // 0-based
+  dynamic_rmq() = default;
+
+  template <typename Iter>
+  dynamic_rmq(Iter first, Iter last, const Compare& comp = Compare())
+      : n(std::distance(first, last)), size(1), comp(comp) {
+    while (size < n) size <<= 1;
+    tree.resize(2 * size, node{T(), -1});
+    for (int i = 0; i < n; ++i) tree[size + i] = node{first[i], i};
+    for (int i = size - 1; i > 0; --i) tree[i] = best(tree[2 * i], tree[2 * i + 1]);
+  }
+
+  // Returns the position of the minimum element in the range [l, r)
+  int operator()(int l, int r) const {
+    node res{T(), -1};
+    for (l += size, r += size; l < r; l >>= 1, r >>= 1) {
+      if (l & 1) res = best(res, tree[l++]);
+      if (r & 1) res = best(res, tree[--r]);
+    }
+    return res.pos;
+  }
+
+  // Returns the current value at position i
+  const T& operator[](int i) const { return tree[size + i].value; }
+
+  // Sets the value at position i to v
+  void update(int i, const T& v) {
+    i += size;
+    tree[i].value = v;
+    for (i >>= 1; i > 0; i >>= 1) tree[i] = best(tree[2 * i], tree[2 * i + 1]);
+  }
+
+  private:
+  struct node {
+    T value;
+    int pos;  // -1 marks padding / the empty result
+  };
+
+  int n, size;
+  Compare comp;
+  std::vector<node> tree;
+
+  inline const node& best(const node& x, const node& y) const {
+    if (x.pos == -1) return y;
+    if (y.pos == -1) return x;
+    if (comp(y.value, x.value)) return y;
+    if (comp(x.value, y.value)) return x;
+    return x.pos < y.pos ? x : y;
+  }
+};
+
+#ifdef LOCAL
+#include <iostream>
+using namespace std;
+
+int main() {
+  vector<int> a = {4, 1, 8, 2, 9, 0, 3};
+  dynamic_rmq<int> rmq(a.begin(), a.end());
+
+  struct Step {
+    char op;  // 'Q' = query [x, y), 'U' = set a[x] = y
+    int x, y, expected;
+  } steps[] = {{'Q', 0, 7, 5}, {'Q', 0, 5, 1}, {'U', 5, 10, 0}, {'Q', 0, 7, 1},
+               {'U', 2, -1, 0}, {'Q', 0, 7, 2}, {'Q', 3, 7, 3}};
+
+  for (const auto& s : steps) {
+    if (s.op == 'U') {
+      rmq.update(s.x, s.y);
+      cout << "Set a[" << s.x << "] = " << s.y << endl;
+      continue;
+    }
+    int idx = rmq(s.x, s.y);
+    cout << "Minimum index in range [" << s.x << ", " << s.y << "): " << idx;
+    cout << " (Expected: " << s.expected << ")";
+    if (idx != s.expected) cout << " [ERROR]";
+    cout << endl;
+  }
+  return 0;
+}
+#endif
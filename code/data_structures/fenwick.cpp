@@ -6,6 +6,9 @@
 // @space      $O(N)$
 // =============================================================================
 
+#ifndef FENWICK_CPP
+#define FENWICK_CPP
+
 #include <vector>
 
 template <typename T>
@@ -33,7 +36,9 @@ struct fenwick {  // 1-index
   }
 };
 
-#ifdef LOCAL
+#endif  // FENWICK_CPP
+
+#if defined(LOCAL) && __INCLUDE_LEVEL__ == 0  // Demo only when compiled directly
 #include <iostream>
 using namespace std;
 
@@ -0,0 +1,184 @@
+// =============================================================================
+// @author     Jose A. Romero (jromero132)
+// @algorithm  Chained Hash Set & Packed Bit-Vector Set
+// @docs       Membership-only counterparts of `hash_table`. `hash_set` keeps
+//             the same fixed-capacity linked-array layout (generation-stamped
+//             $O(1)$ `clear()`, user hasher/equality with cached hashes) but
+//             stores no values.
+//             `dense_set` packs a small contiguous universe [lo, hi) into one
+//             bit per key and clears only the words it touched.
+// @time       hash_set: Amortized $O(1)$ operations, $O(1)$ clear
+//             dense_set: $O(1)$ operations, $O(\text{inserted})$ clear
+// @space      hash_set: $O(N + \text{MOD})$, dense_set: $O(U / 64)$ words
+// =============================================================================
+
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+template <typename H, typename Hash = std::hash<H>, typename Equal = std::equal_to<H>>
+struct hash_set {
+  public:
+  static const int N = 5e6 + 10, MOD = 5e5 + 7;
+
+  hash_set(const Hash& hasher = Hash(), const Equal& eq = Equal())
+      : f(-1), p(-1), c(0), live(0), gen(0), hasher(hasher), eq(eq), table(N), hashes(N), link(N),
+        last(MOD, -1), stamp(MOD, 0) {}
+
+  // Forward iterator over live keys
+  struct iterator {
+    const hash_set* hs;
+    int i;
+
+    const H& operator*() const { return hs->table[i]; }
+    iterator& operator++() {
+      do ++i;
+      while (i < hs->c && hs->link[i] == ERASED);
+      return *this;
+    }
+    bool operator==(const iterator& o) const { return i == o.i; }
+    bool operator!=(const iterator& o) const { return i != o.i; }
+  };
+
+  iterator begin() const {
+    iterator it = {this, -1};
+    return ++it;
+  }
+  iterator end() const { return {this, c}; }
+
+  int size() const { return live; }
+
+  void clear() {
+    ++gen;
+    c = live = 0;
+  }
+
+  bool find(const H& key) { return find(key, hasher(key)); }
+
+  // Inserts the key and returns true if it was not already present
+  bool insert(const H& key) {
+    const size_t h = hasher(key);
+    if (find(key, h)) return false;
+    const int idx = get_idx(h);
+    table[c] = key;
+    hashes[c] = h;
+    link[c] = head(idx);
+    stamp[idx] = gen;
+    last[idx] = c++;
+    ++live;
+    return true;
+  }
+
+  void erase(const H& key) {
+    const size_t h = hasher(key);
+    if (!find(key, h)) return;
+    if (f == -1) {
+      last[get_idx(h)] = link[p];
+    } else {
+      link[f] = link[p];
+    }
+    link[p] = ERASED;
+    --live;
+  }
+
+  private:
+  static const int ERASED = -2;
+
+  int f, p, c, live, gen;
+  Hash hasher;
+  Equal eq;
+  std::vector<H> table;
+  std::vector<size_t> hashes;
+  std::vector<int> link, last, stamp;
+
+  bool find(const H& key, size_t h) {
+    for (f = -1, p = head(get_idx(h)); p != -1; f = p, p = link[p]) {
+      if (hashes[p] == h && eq(table[p], key)) return true;
+    }
+    return false;
+  }
+
+  inline int head(int idx) const { return stamp[idx] == gen ? last[idx] : -1; }
+
+  static inline int get_idx(size_t h) { return static_cast<int>(h % MOD); }
+};
+
+struct dense_set {
+  public:
+  // Universe of keys is the half-open range [lo, hi)
+  dense_set(long long lo, long long hi) : lo(lo), live(0), bits((hi - lo + 63) >> 6) {}
+
+  int size() const { return live; }
+
+  bool find(long long key) const {
+    key -= lo;
+    return bits[key >> 6] >> (key & 63) & 1;
+  }
+
+  // Inserts the key and returns true if it was not already present
+  bool insert(long long key) {
+    key -= lo;
+    unsigned long long& w = bits[key >> 6];
+    const unsigned long long b = 1ULL << (key & 63);
+    if (w & b) return false;
+    if (w == 0) dirty.push_back(static_cast<int>(key >> 6));
+    w |= b;
+    ++live;
+    return true;
+  }
+
+  void erase(long long key) {
+    key -= lo;
+    unsigned long long& w = bits[key >> 6];
+    const unsigned long long b = 1ULL << (key & 63);
+    if (w & b) {
+      w ^= b;
+      --live;
+    }
+  }
+
+  // Zeroes only the words written since the last clear
+  void clear() {
+    for (int w : dirty) bits[w] = 0;
+    dirty.clear();
+    live = 0;
+  }
+
+  private:
+  long long lo;
+  int live;
+  std::vector<unsigned long long> bits;
+  std::vector<int> dirty;
+};
+
+#ifdef LOCAL
+#include <iostream>
+using namespace std;
+
+int main() {
+  hash_set<long long> hs;
+  dense_set ds(-100, 100);
+  long long stream[] = {5, -42, 5, 99, -42, 0, -100, 7};
+
+  int unique_hs = 0, unique_ds = 0;
+  for (long long x : stream) {
+    unique_hs += hs.insert(x);
+    unique_ds += ds.insert(x);
+  }
+  cout << "Distinct (hash_set)? Expected: 6 | Found: " << unique_hs;
+  cout << (unique_hs != 6 || hs.size() != 6 ? " [ERROR]" : "") << endl;
+  cout << "Distinct (dense_set)? Expected: 6 | Found: " << unique_ds;
+  cout << (unique_ds != 6 || ds.size() != 6 ? " [ERROR]" : "") << endl;
+
+  hs.erase(99);
+  ds.erase(99);
+  cout << "Contains 99 after erase? Expected: 0 0 | Found: " << hs.find(99) << " " << ds.find(99);
+  cout << (hs.find(99) || ds.find(99) ? " [ERROR]" : "") << endl;
+
+  hs.clear();
+  ds.clear();
+  cout << "Contains 5 after clear? Expected: 0 0 | Found: " << hs.find(5) << " " << ds.find(5);
+  cout << (hs.find(5) || ds.find(5) ? " [ERROR]" : "") << endl;
+  return 0;
+}
+#endif
@@ -1,67 +1,141 @@
 // =============================================================================
 // @author     Jose A. Romero (jromero132)
 // @algorithm  Chained Hash Table (Fixed-Capacity Variant)
-// @docs       Static tracking map utilizing linked arrays. Safely handles
-//             signed and negative keys via standardized absolute remainder
-//             mapping.
-// @time       Amortized $O(1)$ operations
+// @docs       Static tracking map utilizing linked arrays. Keys of any type
+//             are supported through a user hasher and equality functor
+//             (defaulting to `std::hash` / `std::equal_to`); the full hash is
+//             cached beside each entry, so chain walks compare hashes first
+//             and only touch the key on a match. Bucket heads are
+//             generation-stamped, so one instance can be reused across test
+//             cases with an $O(1)$ `clear()`. `operator[]`, `try_emplace` and
+//             `update` insert or aggregate with a single hash and chain walk.
+// @time       Amortized $O(1)$ operations, $O(1)$ clear
 //             Worst-case $O(N)$ under deep collisions
+//             Iteration $O(\text{entries inserted since the last clear})$
 // @space      $O(N + \text{MOD})$
 // =============================================================================
 
+#include <cstddef>
 #include <cstring>
+#include <functional>
+#include <utility>
 #include <vector>
 
-template <typename H, typename T>
+template <typename H, typename T, typename Hash = std::hash<H>, typename Equal = std::equal_to<H>>
 struct hash_table {
   public:
   static const int N = 5e6 + 10, MOD = 5e5 + 7;
 
-  hash_table() : f(-1), p(-1), c(0), table(N), value(N), link(N), last(MOD, -1) {}
+  hash_table(const Hash& hasher = Hash(), const Equal& eq = Equal())
+      : f(-1), p(-1), c(0), live(0), gen(0), hasher(hasher), eq(eq), table(N), value(N),
+        hashes(N), link(N), last(MOD, -1), stamp(MOD, 0) {}
 
-  // Returns a pointer to the value associated with the given hash key, or nullptr
-  T* find(H hash) {
-    const int idx = get_idx(hash);
-    for (f = -1, p = last[idx]; p != -1; f = p, p = link[p]) {
-      if (table[p] == hash) return &value[p];
+  // Forward iterator over live entries, dereferencing to a (key, value) pair
+  struct iterator {
+    hash_table* ht;
+    int i;
+
+    std::pair<const H&, T&> operator*() const { return {ht->table[i], ht->value[i]}; }
+    iterator& operator++() {
+      do ++i;
+      while (i < ht->c && ht->link[i] == ERASED);
+      return *this;
     }
-    return nullptr;
+    bool operator==(const iterator& o) const { return i == o.i; }
+    bool operator!=(const iterator& o) const { return i != o.i; }
+  };
+
+  iterator begin() {
+    iterator it = {this, -1};
+    return ++it;
   }
+  iterator end() { return {this, c}; }
 
-  // Inserts or updates the value associated with the given hash key
-  void set(H hash, T val) {
-    if (find(hash) != nullptr) {
-      value[p] = val;
-    } else {
-      const int idx = get_idx(hash);
-      table[c] = hash;
-      value[c] = val;
-      link[c] = last[idx];
-      last[idx] = c++;
-    }
+  int size() const { return live; }
+
+  // Forgets every entry in $O(1)$ by invalidating all bucket heads at once
+  void clear() {
+    ++gen;
+    c = live = 0;
+  }
+
+  // Returns a pointer to the value associated with the given key, or nullptr
+  T* find(const H& key) { return find(key, hasher(key)); }
+
+  // Inserts or updates the value associated with the given key
+  void set(const H& key, T val) {
+    std::pair<T*, bool> res = try_emplace(key, val);
+    if (!res.second) *res.first = val;
+  }
+
+  // Inserts `val` only if `key` is absent; returns the key's value and whether it was inserted
+  std::pair<T*, bool> try_emplace(const H& key, const T& val) {
+    const size_t h = hasher(key);
+    T* res = find(key, h);
+    if (res != nullptr) return std::make_pair(res, false);
+    return std::make_pair(push(key, h, val), true);
   }
 
-  void erase(H hash) {
-    if (find(hash) == nullptr) return;
-    const int idx = get_idx(hash);
+  // Returns the value associated with the given key, inserting T() first if absent
+  T& operator[](const H& key) { return *try_emplace(key, T()).first; }
+
+  // Folds `delta` into the key's value (T() if absent) as combine(value, delta) in one probe
+  template <typename Combine = std::plus<T>>
+  T& update(const H& key, const T& delta, Combine combine = Combine()) {
+    const size_t h = hasher(key);
+    T* res = find(key, h);
+    if (res == nullptr) res = push(key, h, T());
+    return *res = combine(*res, delta);
+  }
+
+  void erase(const H& key) {
+    const size_t h = hasher(key);
+    if (find(key, h) == nullptr) return;
     if (f == -1) {
-      last[idx] = link[p];
+      last[get_idx(h)] = link[p];
     } else {
       link[f] = link[p];
     }
+    link[p] = ERASED;
+    --live;
   }
 
   private:
-  int f, p, c;
+  static const int ERASED = -2;  // Link marker skipped by iteration
+
+  int f, p, c, live, gen;
+  Hash hasher;
+  Equal eq;
   std::vector<H> table;
   std::vector<T> value;
-  std::vector<int> link, last;
+  std::vector<size_t> hashes;
+  std::vector<int> link, last, stamp;
+
+  // Walks the chain of `h`, leaving `p` on the match and `f` on its predecessor
+  T* find(const H& key, size_t h) {
+    for (f = -1, p = head(get_idx(h)); p != -1; f = p, p = link[p]) {
+      if (hashes[p] == h && eq(table[p], key)) return &value[p];
+    }
+    return nullptr;
+  }
 
-  inline int get_idx(H hash) const {
-    long long rem = static_cast<long long>(hash) % MOD;
-    if (rem < 0) rem += MOD;
-    return static_cast<int>(rem);
+  // Links a new entry at the head of its bucket chain
+  T* push(const H& key, size_t h, const T& val) {
+    const int idx = get_idx(h);
+    table[c] = key;
+    value[c] = val;
+    hashes[c] = h;
+    link[c] = head(idx);
+    stamp[idx] = gen;
+    last[idx] = c;
+    ++live;
+    return &value[c++];
   }
+
+  // Bucket heads written before the last clear() read as empty
+  inline int head(int idx) const { return stamp[idx] == gen ? last[idx] : -1; }
+
+  static inline int get_idx(size_t h) { return static_cast<int>(h % MOD); }
 };
 
 #ifdef LOCAL
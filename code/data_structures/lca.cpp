@@ -0,0 +1,131 @@
+// =============================================================================
+// @author     Jose A. Romero (jromero132)
+// @algorithm  Lowest Common Ancestor (Euler Tour + `rmq_direct`)
+// @docs       Static LCA over a tree given as an undirected adjacency list
+//             (0-based, connected, rooted at `root`). The tour is built with
+//             an explicit stack, so deep paths cannot overflow the call stack.
+//             Default mode: owning `rmq_direct` over the 2N-1 Euler positions,
+//             each packing (depth << 32 | vertex), so a query reads one cell.
+//             `Lean = true` drops the tour: position i of the preorder keeps
+//             the preorder index of its parent, and the minimum over
+//             (tin[u], tin[v]] is the LCA's index. N entries with 32-bit
+//             masks instead of 2N with 64-bit ones: ~16 vs ~36 bytes/node.
+// @time       Preprocessing: $O(N)$, Query: $O(1)$
+// @space      $O(N)$
+// =============================================================================
+
+#include <algorithm>
+#include <functional>
+#include <type_traits>
+#include <vector>
+
+#include "rmq_direct.cpp"
+
+template <bool Lean = false>
+struct lca {  // 0-based
+  lca() = default;
+
+  lca(const std::vector<std::vector<int>>& adj, int root = 0, int threads = 1) : pos(adj.size()) {
+    build(adj, root, threads, std::integral_constant<bool, Lean>());
+  }
+
+  // Returns the lowest common ancestor of u and v
+  int operator()(int u, int v) const {
+    int a = pos[u], b = pos[v];
+    if (a > b) std::swap(a, b);
+    return query(u, a, b, std::integral_constant<bool, Lean>());
+  }
+
+  private:
+  typedef typename std::conditional<Lean, int, long long>::type key;
+  typedef typename std::conditional<Lean, unsigned int, unsigned long long>::type mask;
+
+  std::vector<int> pos;    // Euler first occurrence (default) or preorder index (lean)
+  std::vector<int> order;  // Lean only: vertex at each preorder index
+  rmq_direct<key, std::less<key>, true, mask> rmq;
+
+  // Calls enter(w, parent, depth) on first arrival at w and back(u, depth) on returns to u
+  template <typename Enter, typename Back>
+  static void dfs(const std::vector<std::vector<int>>& adj, int root, Enter enter, Back back) {
+    const int n = adj.size();
+    std::vector<int> parent(n, -1), depth(n, 0), next(n, 0), stk;
+    stk.reserve(n);
+    stk.push_back(root);
+    enter(root, -1, 0);
+    while (!stk.empty()) {
+      const int u = stk.back();
+      if (next[u] < static_cast<int>(adj[u].size())) {
+        const int w = adj[u][next[u]++];
+        if (w == parent[u]) continue;
+        parent[w] = u;
+        depth[w] = depth[u] + 1;
+        enter(w, u, depth[w]);
+        stk.push_back(w);
+      } else {
+        stk.pop_back();
+        if (!stk.empty()) back(stk.back(), depth[stk.back()]);
+      }
+    }
+  }
+
+  void build(const std::vector<std::vector<int>>& adj, int root, int threads, std::false_type) {
+    std::vector<key> tour;
+    tour.reserve(2 * adj.size());
+    dfs(adj, root,
+        [&](int w, int, int d) {
+          pos[w] = tour.size();
+          tour.push_back(static_cast<key>(d) << 32 | w);
+        },
+        [&](int u, int d) { tour.push_back(static_cast<key>(d) << 32 | u); });
+    rmq = decltype(rmq)(tour.begin(), tour.end(), std::less<key>(), threads);
+  }
+
+  void build(const std::vector<std::vector<int>>& adj, int root, int threads, std::true_type) {
+    std::vector<key> parent_pos;
+    parent_pos.reserve(adj.size());
+    order.reserve(adj.size());
+    dfs(adj, root,
+        [&](int w, int p, int) {
+          pos[w] = order.size();
+          order.push_back(w);
+          parent_pos.push_back(p == -1 ? 0 : pos[p]);
+        },
+        [](int, int) {});
+    rmq = decltype(rmq)(parent_pos.begin(), parent_pos.end(), std::less<key>(), threads);
+  }
+
+  int query(int, int a, int b, std::false_type) const {
+    return static_cast<int>(rmq[rmq(a, b + 1)] & 0xffffffffLL);
+  }
+
+  int query(int u, int a, int b, std::true_type) const {
+    return a == b ? u : order[rmq[rmq(a + 1, b + 1)]];
+  }
+};
+
+#ifdef LOCAL
+#include <iostream>
+using namespace std;
+
+int main() {
+  // Edges: 0-1, 0-2, 0-3, 1-4, 1-5, 3-6, 5-7 (rooted at 0)
+  vector<vector<int>> adj(8);
+  int edges[][2] = {{0, 1}, {0, 2}, {0, 3}, {1, 4}, {1, 5}, {3, 6}, {5, 7}};
+  for (auto& e : edges) {
+    adj[e[0]].push_back(e[1]);
+    adj[e[1]].push_back(e[0]);
+  }
+  lca<> euler(adj);
+  lca<true> lean(adj);
+
+  int queries[][3] = {{4, 7, 1}, {7, 6, 0}, {5, 7, 5}, {2, 2, 2}, {4, 5, 1}, {6, 3, 3}, {7, 2, 0}};
+  for (auto& q : queries) {
+    int x = euler(q[0], q[1]), y = lean(q[0], q[1]);
+    cout << "LCA(" << q[0] << ", " << q[1] << "): " << x << " / lean " << y;
+    cout << " (Expected: " << q[2] << ")";
+    if (x != q[2] || y != q[2]) cout << " [ERROR]";
+    cout << endl;
+  }
+  return 0;
+}
+#endif
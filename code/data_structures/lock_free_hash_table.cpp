@@ -0,0 +1,130 @@
+// =============================================================================
+// @author     Jose A. Romero (jromero132)
+// @algorithm  Lock-Free Open-Addressing Hash Table (Linear Probing)
+// @docs       Fixed-capacity concurrent map for integral keys. Inserting
+//             threads claim empty slots with a single CAS on the key, lookups
+//             are wait-free (bounded by the capacity) and values are atomics,
+//             so counters can be aggregated with `fetch_add`. Keys are never
+//             removed; one key value is reserved as the empty-slot marker.
+//             The marker itself is never found or inserted. Once every slot
+//             is claimed, `insert` of a new key returns nullptr and
+//             `fetch_add` returns false. Capacity is at most 2^30 (asserted;
+//             larger requests are clamped).
+// @time       Expected $O(1)$ per operation at load factor below ~0.7
+// @space      $O(\text{capacity})$, rounded up to a power of two
+// =============================================================================
+
+#include <atomic>
+#include <cassert>
+#include <limits>
+#include <vector>
+
+template <typename K, typename V>
+struct lock_free_hash_table {
+  public:
+  explicit lock_free_hash_table(int capacity, K empty_key = std::numeric_limits<K>::max())
+      : mask(round_up(capacity) - 1), empty(empty_key), slots(mask + 1) {
+    for (int i = 0; i <= mask; ++i) {
+      slots[i].key.store(empty, std::memory_order_relaxed);
+      slots[i].value.store(V(), std::memory_order_relaxed);
+    }
+  }
+
+  // Returns the atomic value bound to `key`, or nullptr if absent. Wait-free
+  std::atomic<V>* find(K key) {
+    if (key == empty) return nullptr;
+    for (int i = get_idx(key), steps = 0; steps <= mask; i = (i + 1) & mask, ++steps) {
+      const K cur = slots[i].key.load(std::memory_order_acquire);
+      if (cur == key) return &slots[i].value;
+      if (cur == empty) return nullptr;
+    }
+    return nullptr;
+  }
+
+  // Returns the atomic value bound to `key`, claiming a slot (value V()) if absent, or nullptr
+  // if `key` is the empty marker or is absent from a full table
+  std::atomic<V>* insert(K key) {
+    if (key == empty) return nullptr;
+    for (int i = get_idx(key), steps = 0; steps <= mask; i = (i + 1) & mask, ++steps) {
+      K cur = slots[i].key.load(std::memory_order_acquire);
+      if (cur == empty) {
+        if (slots[i].key.compare_exchange_strong(cur, key, std::memory_order_acq_rel)) {
+          return &slots[i].value;
+        }
+        // Lost the race: `cur` now holds the winner's key
+      }
+      if (cur == key) return &slots[i].value;
+    }
+    return nullptr;
+  }
+
+  // Atomically adds `delta` to the value of `key` (inserting it first), storing the previous
+  // value in `*old` if given. Returns false, changing nothing, if insert() would fail
+  bool fetch_add(K key, V delta, V* old = nullptr) {
+    std::atomic<V>* value = insert(key);
+    if (value == nullptr) return false;
+    const V prev = value->fetch_add(delta, std::memory_order_relaxed);
+    if (old != nullptr) *old = prev;
+    return true;
+  }
+
+  int capacity() const { return mask + 1; }
+
+  private:
+  struct slot {
+    std::atomic<K> key;
+    std::atomic<V> value;
+  };
+
+  int mask;
+  K empty;
+  std::vector<slot> slots;
+
+  static const int MAX_CAPACITY = 1 << 30;  // Largest power of two an int holds
+
+  static int round_up(int n) {
+    assert(n <= MAX_CAPACITY && "lock_free_hash_table capacity is limited to 2^30");
+    int p = 1;
+    while (p < n && p < MAX_CAPACITY) p <<= 1;
+    return p;
+  }
+
+  // SplitMix64 finalizer: sequential ids must not cluster into one probe run
+  inline int get_idx(K key) const {
+    unsigned long long x = static_cast<unsigned long long>(key) + 0x9e3779b97f4a7c15ULL;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    return static_cast<int>((x ^ (x >> 31)) & mask);
+  }
+};
+
+#ifdef LOCAL
+#include <iostream>
+#include <thread>
+using namespace std;
+
+int main() {
+  const int threads = 4, ops = 100000, keys = 1000;
+  lock_free_hash_table<long long, long long> ht(2 * keys);
+
+  vector<thread> pool;
+  for (int t = 0; t < threads; ++t) {
+    pool.emplace_back([&ht]() {
+      for (int i = 0; i < ops; ++i) ht.fetch_add(i % keys, 1);
+    });
+  }
+  for (auto& th : pool) th.join();
+
+  const long long expected = 1LL * threads * ops / keys;
+  for (int k = 0; k < 5; ++k) {
+    atomic<long long>* res = ht.find(k);
+    cout << "Key: " << k << " | Expected: " << expected
+         << " | Found: " << (res ? res->load() : -1);
+    if (!res || res->load() != expected) cout << " [ERROR]";
+    cout << endl;
+  }
+  cout << "Missing key 5000 found? Expected: 0 | Found: " << (ht.find(5000) != nullptr);
+  cout << (ht.find(5000) != nullptr ? " [ERROR]" : "") << endl;
+  return 0;
+}
+#endif
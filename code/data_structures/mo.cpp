@@ -0,0 +1,139 @@
+// =============================================================================
+// @author     Jose A. Romero (jromero132)
+// @algorithm  Mo's Algorithm (Hilbert Order + Rollback Variant)
+// @docs       Offline engine for 0-based, half-open [l, r) range queries over
+//             n positions. The problem lives in user callbacks taken as
+//             template functors, so calls inline: `add(i)` / `remove(i)`
+//             move the window over position i and `answer(q)` runs when the
+//             window equals query q. Queries are visited in Hilbert-curve
+//             order of (l, r) by default, or in classic odd-even block order.
+//             `solve_rollback` serves add-only states (e.g. DSU): per block
+//             of l it only grows the right end, and every query's left part
+//             is added after `save()` and undone with `rollback()`; `reset()`
+//             empties the state between blocks.
+// @time       $O(N \sqrt{Q})$ callback calls, plus $O(Q \log Q)$ sorting
+// @space      $O(Q)$
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+#include <vector>
+
+struct mo {  // 0-based
+  // Calls answer(q) for every query with the window at [l_q, r_q)
+  template <typename Add, typename Remove, typename Answer>
+  static void solve(int n, const std::vector<std::pair<int, int>>& queries, Add add, Remove remove,
+                    Answer answer, bool hilbert = true) {
+    int l = 0, r = 0;
+    for (int q : order(n, queries, hilbert)) {
+      const int ql = queries[q].first, qr = queries[q].second;
+      while (r < qr) add(r++);
+      while (l > ql) add(--l);
+      while (r > qr) remove(--r);
+      while (l < ql) remove(l++);
+      answer(q);
+    }
+  }
+
+  // Same as above for states that can only grow; save() / rollback() undo the left part
+  template <typename Add, typename Answer, typename Save, typename Rollback, typename Reset>
+  static void solve_rollback(int n, const std::vector<std::pair<int, int>>& queries, Add add,
+                             Answer answer, Save save, Rollback rollback, Reset reset) {
+    const int q = queries.size(), block = block_size(n, q);
+    std::vector<int> ids(q);
+    for (int i = 0; i < q; ++i) ids[i] = i;
+    std::sort(ids.begin(), ids.end(), [&](int x, int y) {
+      const int bx = queries[x].first / block, by = queries[y].first / block;
+      return bx != by ? bx < by : queries[x].second < queries[y].second;
+    });
+
+    int cur_block = -1, mid = 0, r = 0;
+    for (int id : ids) {
+      const int ql = queries[id].first, qr = queries[id].second;
+      if (ql / block != cur_block) {
+        cur_block = ql / block;
+        mid = r = std::min(n, (cur_block + 1) * block);
+        reset();
+      }
+      if (qr <= mid) {  // Short query: entirely inside the block, state is still empty
+        save();
+        for (int i = ql; i < qr; ++i) add(i);
+      } else {
+        while (r < qr) add(r++);
+        save();
+        for (int i = mid - 1; i >= ql; --i) add(i);
+      }
+      answer(id);
+      rollback();
+    }
+  }
+
+  private:
+  static int block_size(int n, int q) {
+    return std::max(1, static_cast<int>(n / std::sqrt(std::max(1.0, static_cast<double>(q)))));
+  }
+
+  // Index of (x, y) along the Hilbert curve filling a side x side square (side a power of two)
+  static long long hilbert_index(int x, int y, int side) {
+    long long d = 0;
+    for (int s = side / 2; s > 0; s /= 2) {
+      const int rx = (x & s) > 0, ry = (y & s) > 0;
+      d += 1LL * s * s * ((3 * rx) ^ ry);
+      if (ry == 0) {
+        if (rx == 1) x = side - 1 - x, y = side - 1 - y;
+        std::swap(x, y);
+      }
+    }
+    return d;
+  }
+
+  static std::vector<int> order(int n, const std::vector<std::pair<int, int>>& queries,
+                                bool hilbert) {
+    const int q = queries.size();
+    std::vector<int> ids(q);
+    for (int i = 0; i < q; ++i) ids[i] = i;
+    if (hilbert) {
+      int side = 1;
+      while (side <= n) side <<= 1;
+      std::vector<long long> key(q);
+      for (int i = 0; i < q; ++i) key[i] = hilbert_index(queries[i].first, queries[i].second, side);
+      std::sort(ids.begin(), ids.end(), [&key](int x, int y) { return key[x] < key[y]; });
+    } else {
+      const int block = block_size(n, q);
+      std::sort(ids.begin(), ids.end(), [&](int x, int y) {
+        const int bx = queries[x].first / block, by = queries[y].first / block;
+        if (bx != by) return bx < by;
+        return bx & 1 ? queries[x].second > queries[y].second
+                      : queries[x].second < queries[y].second;
+      });
+    }
+    return ids;
+  }
+};
+
+#ifdef LOCAL
+#include <iostream>
+using namespace std;
+
+int main() {
+  vector<int> a = {1, 2, 1, 3, 2, 2, 5};
+  vector<pair<int, int>> queries = {{0, 7}, {0, 3}, {1, 2}, {2, 6}, {4, 6}, {3, 3}};
+  vector<int> expected = {4, 2, 1, 3, 1, 0};
+
+  // Distinct values in a range
+  vector<int> cnt(6, 0), res(queries.size());
+  int distinct = 0;
+  mo::solve(
+      a.size(), queries, [&](int i) { distinct += cnt[a[i]]++ == 0; },
+      [&](int i) { distinct -= --cnt[a[i]] == 0; }, [&](int q) { res[q] = distinct; });
+
+  for (int i = 0; i < queries.size(); ++i) {
+    cout << "Distinct in [" << queries[i].first << ", " << queries[i].second << "): " << res[i];
+    cout << " (Expected: " << expected[i] << ")";
+    if (res[i] != expected[i]) cout << " [ERROR]";
+    cout << endl;
+  }
+  return 0;
+}
+#endif
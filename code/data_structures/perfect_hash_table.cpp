@@ -0,0 +1,220 @@
+// =============================================================================
+// @author     Jose A. Romero (jromero132)
+// @algorithm  Static Minimal Perfect Hash Table (PTHash-Style Displacement)
+// @docs       Read-only map built once from a range of (key, value) pairs
+//             with integral keys; a repeated key keeps its first value. Keys
+//             are split into skewed buckets (60% of keys into 30% of
+//             buckets) that are placed largest first, each searching a 16-bit
+//             pilot that sends all of its keys to free slots of a table with
+//             load factor 0.99 (up to 64 spare slots for small tables). Slots
+//             beyond n are remapped into the holes below n, so every key lands
+//             in [0, n) and lookups are a single probe with no chains.
+// @time       Build: Expected $O(N)$ ($O(N \log N)$ with repeated keys),
+//             Query: $O(1)$ worst-case
+// @space      $O(N)$ entries plus ~3.5 bits/key of pilots and remapping
+// =============================================================================
+
+#include <algorithm>
+#include <vector>
+
+template <typename H, typename T>
+struct perfect_hash_table {
+  public:
+  perfect_hash_table() : n(0), m(1), nb(1), p1(0), seed(0), pilot(1) {}
+
+  template <typename Iter>
+  perfect_hash_table(Iter first, Iter last) {
+    std::vector<H> in_keys;
+    std::vector<T> in_values;
+    for (Iter it = first; it != last; ++it) {
+      in_keys.push_back(it->first);
+      in_values.push_back(it->second);
+    }
+    seed = 0x2545f4914f6cdd1dULL;
+    for (;;) {
+      n = in_keys.size();
+      m = n + std::max(n / 99, std::min(n, 64)) + 1;  // Small tables get slack
+      nb = std::max(2, (n + LAMBDA - 1) / LAMBDA);  // Both bucket halves must be non-empty
+      p1 = std::min(nb - 1, std::max(1, static_cast<int>(0.3 * nb)));
+      const build_status status = build(in_keys);
+      if (status == BUILT) break;
+      if (status == DUPLICATE_KEYS) drop_duplicates(in_keys, in_values);
+      else seed = mix(seed);
+    }
+
+    keys.resize(n);
+    values.resize(n);
+    for (int i = 0; i < n; ++i) {
+      const int p = get_pos(in_keys[i]);
+      keys[p] = in_keys[i];
+      values[p] = in_values[i];
+    }
+  }
+
+  int size() const { return n; }
+
+  // Returns the slot in [0, n) holding `key`, or -1 if it was not in the build set
+  int index(H key) const {
+    if (n == 0) return -1;
+    const int p = get_pos(key);
+    return keys[p] == key ? p : -1;
+  }
+
+  // Returns a pointer to the value associated with `key`, or nullptr
+  T* find(H key) {
+    const int p = index(key);
+    return p == -1 ? nullptr : &values[p];
+  }
+
+  private:
+  static const int LAMBDA = 5;  // Average keys per bucket: 16 / 5 = 3.2 pilot bits/key
+  static const int MAX_PILOT = 1 << 16;
+
+  enum build_status { BUILT, RESEED, DUPLICATE_KEYS };
+
+  int n, m, nb, p1;
+  unsigned long long seed;
+  std::vector<unsigned short> pilot;
+  std::vector<int> remap;
+  std::vector<H> keys;
+  std::vector<T> values;
+
+  static inline unsigned long long mix(unsigned long long x) {
+    x += 0x9e3779b97f4a7c15ULL;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    return x ^ (x >> 31);
+  }
+
+  // Maps a 64-bit hash uniformly onto [0, range) without a division: the high word of
+  // h * range, computed exactly from 32-bit halves since range < 2^31
+  static inline int fast_range(unsigned long long h, int range) {
+    const unsigned long long r = range;
+    return static_cast<int>(((h >> 32) * r + ((h & 0xffffffffULL) * r >> 32)) >> 32);
+  }
+
+  inline unsigned long long key_hash(H key) const {
+    return mix(static_cast<unsigned long long>(key) ^ seed);
+  }
+
+  // Low byte picks the dense/sparse bucket half, the rest of the low word picks the bucket
+  inline int get_bucket(unsigned long long h) const {
+    const unsigned int lo = static_cast<unsigned int>(h);
+    if ((lo & 255) < 154) return static_cast<int>((static_cast<unsigned long long>(lo) * p1) >> 32);
+    return p1 + static_cast<int>((static_cast<unsigned long long>(lo) * (nb - p1)) >> 32);
+  }
+
+  inline int get_slot(unsigned long long h, int pilot_value) const {
+    return fast_range(h ^ mix(pilot_value + seed), m);
+  }
+
+  inline int get_pos(H key) const {
+    const unsigned long long h = key_hash(key);
+    const int p = get_slot(h, pilot[get_bucket(h)]);
+    return p < n ? p : remap[p - n];
+  }
+
+  // Keeps the first occurrence of every key, like std::map::insert
+  static void drop_duplicates(std::vector<H>& in_keys, std::vector<T>& in_values) {
+    std::vector<int> order(in_keys.size());
+    for (int i = 0; i < static_cast<int>(order.size()); ++i) order[i] = i;
+    std::stable_sort(order.begin(), order.end(),
+                     [&in_keys](int a, int b) { return in_keys[a] < in_keys[b]; });
+    std::vector<char> keep(order.size(), 1);
+    for (int i = 1; i < static_cast<int>(order.size()); ++i) {
+      keep[order[i]] = in_keys[order[i]] != in_keys[order[i - 1]];
+    }
+    int w = 0;
+    for (int i = 0; i < static_cast<int>(order.size()); ++i) {
+      if (keep[i]) in_keys[w] = in_keys[i], in_values[w] = in_values[i], ++w;
+    }
+    in_keys.resize(w);
+    in_values.resize(w);
+  }
+
+  // Searches a pilot per bucket. `mix` is a bijection, so equal hashes mean equal keys:
+  // reseeding cannot separate them and the caller has to drop the duplicates instead.
+  build_status build(const std::vector<H>& in_keys) {
+    std::vector<unsigned long long> h(n);
+    std::vector<int> start(nb + 1, 0);
+    for (int i = 0; i < n; ++i) ++start[get_bucket(h[i] = key_hash(in_keys[i])) + 1];
+    for (int b = 0; b < nb; ++b) start[b + 1] += start[b];
+
+    std::vector<unsigned long long> by_bucket(n);
+    std::vector<int> fill(start.begin(), start.end() - 1);
+    for (int i = 0; i < n; ++i) by_bucket[fill[get_bucket(h[i])]++] = h[i];
+
+    std::vector<int> order(nb);
+    for (int b = 0; b < nb; ++b) order[b] = b;
+    std::stable_sort(order.begin(), order.end(), [&start](int a, int b) {
+      return start[a + 1] - start[a] > start[b + 1] - start[b];
+    });
+
+    std::vector<unsigned long long> pilot_hash(MAX_PILOT);
+    for (int pv = 0; pv < MAX_PILOT; ++pv) pilot_hash[pv] = mix(pv + seed);
+
+    pilot.assign(nb, 0);
+    std::vector<bool> taken(m, false);  // Bit-packed so the hot search stays in cache
+    std::vector<int> slots;
+    for (int b : order) {
+      const int lo = start[b], hi = start[b + 1];
+      if (lo == hi) continue;
+      std::sort(by_bucket.begin() + lo, by_bucket.begin() + hi);
+      for (int i = lo + 1; i < hi; ++i) {
+        if (by_bucket[i] == by_bucket[i - 1]) return DUPLICATE_KEYS;
+      }
+
+      int pv = 0;
+      for (; pv < MAX_PILOT; ++pv) {
+        slots.clear();
+        for (int i = lo; i < hi; ++i) {
+          const int s = fast_range(by_bucket[i] ^ pilot_hash[pv], m);
+          if (taken[s]) break;
+          slots.push_back(s);
+        }
+        if (static_cast<int>(slots.size()) < hi - lo) continue;
+        std::sort(slots.begin(), slots.end());
+        if (std::adjacent_find(slots.begin(), slots.end()) == slots.end()) break;
+      }
+      if (pv == MAX_PILOT) return RESEED;
+
+      pilot[b] = pv;
+      for (int s : slots) taken[s] = true;
+    }
+
+    remap.assign(m - n, 0);
+    for (int s = n, hole = 0; s < m; ++s) {
+      if (!taken[s]) continue;
+      while (taken[hole]) ++hole;
+      remap[s - n] = hole++;
+    }
+    return BUILT;
+  }
+};
+
+#ifdef LOCAL
+#include <iostream>
+#include <utility>
+using namespace std;
+
+int main() {
+  vector<pair<long long, int>> items;
+  for (int i = 0; i < 1000; ++i) items.push_back({1LL * i * i * 7919 - 500000, i});
+  perfect_hash_table<long long, int> pht(items.begin(), items.end());
+
+  int errors = 0;
+  vector<char> used(items.size(), 0);
+  for (const auto& item : items) {
+    int* res = pht.find(item.first);
+    int idx = pht.index(item.first);
+    if (!res || *res != item.second || idx < 0 || used[idx]++) ++errors;
+  }
+  cout << "Keys resolved to distinct slots in [0, n)? Expected errors: 0 | Found: " << errors;
+  cout << (errors ? " [ERROR]" : "") << endl;
+
+  const bool absent = pht.find(123) == nullptr;
+  cout << "Absent key rejected? Expected: 1 | Found: " << absent;
+  cout << (!absent ? " [ERROR]" : "") << endl;
+  return 0;
+}
+#endif
@@ -0,0 +1,85 @@
+// =============================================================================
+// @author     Jose A. Romero (jromero132)
+// @algorithm  Range Distinct Count (Last Occurrence + Fenwick)
+// @docs       Counts distinct values in 0-based, half-open [l, r) ranges.
+//             Streaming: `push_back` appends a value id in [0, universe) and
+//             `count(l)` answers [l, size()) for the prefix seen so far, by
+//             keeping a 1 in a `fenwick<int>` only at the last occurrence of
+//             each value. Offline: `solve` compresses arbitrary values,
+//             buckets the queries by right endpoint (counting sort) and
+//             replays the array through the stream once.
+// @time       Push/Count: $O(\log N)$, Solve: $O((N + Q) \log N)$
+// @space      $O(N + \text{universe})$
+// =============================================================================
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "fenwick.cpp"
+
+struct range_distinct {  // 0-based
+  range_distinct(int capacity, int universe) : n(0), live(0), bit(capacity), last(universe, -1) {}
+
+  // Appends a value id in [0, universe)
+  void push_back(int x) {
+    if (last[x] != -1) bit.update(last[x] + 1, -1);
+    else ++live;
+    bit.update(n + 1, 1);
+    last[x] = n++;
+  }
+
+  // Returns the number of distinct values in [l, size())
+  int count(int l) const { return live - bit.query(l); }
+
+  int size() const { return n; }
+
+  // Returns, for every query [l, r), the number of distinct values of a in that range
+  template <typename T>
+  static std::vector<int> solve(const std::vector<T>& a,
+                                const std::vector<std::pair<int, int>>& queries) {
+    std::vector<T> values(a);
+    std::sort(values.begin(), values.end());
+    values.erase(std::unique(values.begin(), values.end()), values.end());
+
+    const int n = a.size(), q = queries.size();
+    std::vector<int> head(n + 1, -1), next(q), res(q);
+    for (int i = 0; i < q; ++i) {
+      next[i] = head[queries[i].second];
+      head[queries[i].second] = i;
+    }
+
+    range_distinct stream(n, values.size());
+    for (int r = 0; r <= n; ++r) {
+      for (int i = head[r]; i != -1; i = next[i]) res[i] = stream.count(queries[i].first);
+      if (r == n) break;
+      stream.push_back(std::lower_bound(values.begin(), values.end(), a[r]) - values.begin());
+    }
+    return res;
+  }
+
+  private:
+  int n, live;
+  fenwick<int> bit;
+  std::vector<int> last;
+};
+
+#ifdef LOCAL
+#include <iostream>
+using namespace std;
+
+int main() {
+  vector<int> a = {1, 2, 1, 3, 2, 2, 5};
+  vector<pair<int, int>> queries = {{0, 7}, {0, 3}, {1, 2}, {2, 6}, {4, 6}, {3, 3}};
+  vector<int> expected = {4, 2, 1, 3, 1, 0};
+
+  vector<int> res = range_distinct::solve(a, queries);
+  for (int i = 0; i < queries.size(); ++i) {
+    cout << "Distinct in [" << queries[i].first << ", " << queries[i].second << "): " << res[i];
+    cout << " (Expected: " << expected[i] << ")";
+    if (res[i] != expected[i]) cout << " [ERROR]";
+    cout << endl;
+  }
+  return 0;
+}
+#endif
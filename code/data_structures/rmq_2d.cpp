@@ -0,0 +1,150 @@
+// =============================================================================
+// @author     Jose A. Romero (jromero132)
+// @algorithm  2D Range Minimum Query (Row Sparse Table + `rmq_direct`)
+// @docs       Static R x C grid (row-major, copied at construction) answering
+//             the (row, col) of a minimum over half-open [r1, r2) x [c1, c2)
+//             under `Compare`; with ties any minimal cell may be returned.
+//             Rows are grouped into blocks of `block` rows. A sparse table
+//             over blocks keeps, per window of 2^k blocks, the best row of
+//             every column plus an `rmq_direct` over those column minima, so
+//             whole blocks cost two O(1) lookups. With `block = 1` (default)
+//             every query is O(1) at ~8 log R bytes per cell. Larger blocks
+//             bound memory to ~8 (1 + log(R / B) / B) bytes per cell and
+//             answer leftover rows through one `rmq_direct` per row. A grid
+//             with no rows or no columns builds nothing and has no queries.
+// @time       Preprocessing: $O(RC \log(R / B) / B + RC)$,
+//             Query: $O(B)$ ($O(1)$ for $B = 1$)
+// @space      $O(RC \log(R / B) / B + RC)$
+// =============================================================================
+
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include "rmq_direct.cpp"
+
+template <typename T, typename Compare = std::less<T>>
+struct rmq_2d {  // 0-based
+  rmq_2d() = default;
+
+  template <typename Iter>
+  rmq_2d(Iter first, int rows, int cols, const Compare& comp = Compare(), int block = 1)
+      : R(rows), C(cols), B(block), nb(rows / block), comp(comp),
+        grid(first, first + 1LL * rows * cols) {
+    if (R == 0 || C == 0) return;  // No cells, so there is nothing to query
+    if (B > 1) {
+      row_rmq.reserve(R);
+      for (int r = 0; r < R; ++r) row_rmq.push_back(line_rmq(row(r), row(r) + C, comp));
+    }
+
+    for (int k = 0, windows = nb; windows > 0; ++k, windows = nb - (1 << k) + 1) {
+      level_start.push_back(col_rmq.size());
+      best.resize(best.size() + static_cast<size_t>(windows) * C);
+      for (int i = 0; i < windows; ++i) {
+        int* cur = &best[static_cast<size_t>(level_start[k] + i) * C];
+        if (k == 0) {
+          for (int c = 0; c < C; ++c) cur[c] = i * B;
+          for (int r = i * B + 1; r < (i + 1) * B; ++r) {
+            for (int c = 0; c < C; ++c) cur[c] = better(cur[c], r, c);
+          }
+        } else {
+          const int* x = &best[static_cast<size_t>(level_start[k - 1] + i) * C];
+          const int* y = &best[static_cast<size_t>(level_start[k - 1] + i + (1 << (k - 1))) * C];
+          for (int c = 0; c < C; ++c) cur[c] = better(x[c], y[c], c);
+        }
+        std::vector<T> column_min(C);
+        for (int c = 0; c < C; ++c) column_min[c] = row(cur[c])[c];
+        col_rmq.push_back(line_rmq(column_min.begin(), column_min.end(), comp));
+      }
+    }
+  }
+
+  // Returns the (row, col) of a minimum element in [r1, r2) x [c1, c2)
+  std::pair<int, int> operator()(int r1, int c1, int r2, int c2) const {
+    std::pair<int, int> res(-1, -1);
+    const int bl = (r1 + B - 1) / B, br = r2 / B;
+    if (bl >= br) {
+      for (int r = r1; r < r2; ++r) consider(res, r, row_rmq[r](c1, c2, row(r)));
+      return res;
+    }
+    for (int r = r1; r < bl * B; ++r) consider(res, r, row_rmq[r](c1, c2, row(r)));
+    const int k = std::__lg(br - bl);
+    consider_window(res, level_start[k] + bl, c1, c2);
+    consider_window(res, level_start[k] + br - (1 << k), c1, c2);
+    for (int r = br * B; r < r2; ++r) consider(res, r, row_rmq[r](c1, c2, row(r)));
+    return res;
+  }
+
+  // Returns the stored value at (r, c)
+  const T& at(int r, int c) const { return row(r)[c]; }
+
+  private:
+  typedef rmq_direct<T, Compare, false, unsigned int> line_rmq;
+
+  // Column c of a window, read through the window's best-row array
+  struct window_view {
+    const T* grid;
+    const int* rows;
+    int cols;
+    const T& operator[](int c) const { return grid[static_cast<size_t>(rows[c]) * cols + c]; }
+  };
+
+  int R, C, B, nb;
+  Compare comp;
+  std::vector<T> grid;
+  std::vector<line_rmq> row_rmq;   // One per row, only when B > 1
+  std::vector<int> level_start;    // First window of each level in `col_rmq`
+  std::vector<int> best;           // Best row per column of each window, window-major
+  std::vector<line_rmq> col_rmq;   // One per window over its column minima
+
+  inline const T* row(int r) const { return &grid[static_cast<size_t>(r) * C]; }
+
+  inline int better(int x, int y, int c) const { return comp(row(y)[c], row(x)[c]) ? y : x; }
+
+  inline void consider(std::pair<int, int>& res, int r, int c) const {
+    if (res.first == -1 || comp(row(r)[c], row(res.first)[res.second])) res = std::make_pair(r, c);
+  }
+
+  inline void consider_window(std::pair<int, int>& res, int w, int c1, int c2) const {
+    const int* rows = &best[static_cast<size_t>(w) * C];
+    const int c = col_rmq[w](c1, c2, window_view{grid.data(), rows, C});
+    consider(res, rows[c], c);
+  }
+};
+
+#ifdef LOCAL
+#include <iostream>
+using namespace std;
+
+int main() {
+  const int rows = 5, cols = 6;
+  vector<int> a = {9, 8, 7, 6, 5, 4,  //
+                   3, 9, 9, 9, 9, 9,  //
+                   9, 9, 1, 9, 9, 9,  //
+                   9, 9, 9, 9, 9, 2,  //
+                   9, 0, 9, 9, 9, 9};
+  rmq_2d<int> full(a.begin(), rows, cols);
+  rmq_2d<int> blocked(a.begin(), rows, cols, less<int>(), 2);
+
+  for (int r1 = 0; r1 < rows; ++r1) {
+    for (int r2 = r1 + 1; r2 <= rows; ++r2) {
+      for (int c1 = 0; c1 < 3; ++c1) {
+        const int c2 = cols - c1;
+        int expected = a[r1 * cols + c1];
+        for (int r = r1; r < r2; ++r) {
+          for (int c = c1; c < c2; ++c) expected = min(expected, a[r * cols + c]);
+        }
+        pair<int, int> x = full(r1, c1, r2, c2), y = blocked(r1, c1, r2, c2);
+        cout << "Minimum in [" << r1 << ", " << r2 << ") x [" << c1 << ", " << c2 << "): "
+             << full.at(x.first, x.second) << " / blocked " << blocked.at(y.first, y.second)
+             << " (Expected: " << expected << ")";
+        if (full.at(x.first, x.second) != expected || blocked.at(y.first, y.second) != expected) {
+          cout << " [ERROR]";
+        }
+        cout << endl;
+      }
+    }
+  }
+  return 0;
+}
+#endif
@@ -3,57 +3,42 @@
 // @algorithm  Direct Range Minimum Query (Fischer-Heun Method)
 // @docs       Static array range lookup structure providing 0-based index
 //             results. Queries operate on half-open intervals [l, r) where l<r.
+//             With `Owning = true` the values are copied into the structure,
+//             interleaved with the per-element block masks, and queries no
+//             longer take the original array. `Mask` picks the block size:
+//             64 elements per block with `unsigned long long` (default), 32
+//             with `unsigned int`; in-block queries are one count-trailing-
+//             zeros instruction. `batch` answers an array of queries with
+//             software prefetching and optional thread splitting; passing
+//             `threads` to the constructor builds blocks and every sparse
+//             table level in parallel.
 // @time       Preprocessing: $O(N)$, Query: $O(1)$
 // @space      $O(N)$
 // =============================================================================
 
+#ifndef RMQ_DIRECT_CPP
+#define RMQ_DIRECT_CPP
+
 #include <algorithm>
-#include <deque>
 #include <functional>
 #include <iterator>
+#include <thread>
+#include <type_traits>
 #include <vector>
 
-template <typename T, typename Compare = std::less<T>>
+template <typename T, typename Compare = std::less<T>, bool Owning = false,
+          typename Mask = unsigned long long>
 struct rmq_direct {  // 0-based
   rmq_direct() = default;
 
   template <typename Iter>
-  rmq_direct(Iter first, Iter last, const Compare& comp = Compare())
-      : n(distance(first, last)),
+  rmq_direct(Iter first, Iter last, const Compare& comp = Compare(), int threads = 1)
+      : n(std::distance(first, last)),
         comp(comp),
-        BlockSize(std::max(static_cast<int>(1), std::__lg(n))),
         TotalBlocks((n + BlockSize - 1) / BlockSize),
         BlocksRMQ((std::__lg(TotalBlocks) + 1) * TotalBlocks),
-        Masks(n) {
-    for (int i = 0, block = 0; i < n;) {
-      for (int end = std::min(n, i + BlockSize), &min_pos = BlocksRMQ[block++] = i; ++i < end;) {
-        if (comp(first[i], first[min_pos])) min_pos = i;
-      }
-    }
-    auto cur_lvl = BlocksRMQ.begin();
-    for (int m, mh = 1; (m = mh << 1) <= TotalBlocks; mh = m) {
-      auto next_lvl = std::next(cur_lvl, TotalBlocks);
-      for (int i = 0; i + mh < TotalBlocks; ++i) {
-        next_lvl[i] = arg_min(cur_lvl[i], cur_lvl[i + mh], first);
-      }
-      cur_lvl = next_lvl;
-    }
-    std::deque<int> deq;
-    for (int i = 0; i < n; i += BlockSize) {
-      while (!deq.empty() && deq.front() < i) {
-        deq.pop_front();
-      }
-      const int end = std::min(n, i + BlockSize);
-      for (int j = i; j < end; ++j) {
-        while (!deq.empty() && comp(first[j], first[deq.back()])) {
-          deq.pop_back();
-        }
-        if (!deq.empty()) {
-          Masks[j] = Masks[deq.back()] | (1 << (deq.back() - i));
-        }
-        deq.push_back(j);
-      }
-    }
+        Cells(n) {
+    build(first, threads, std::integral_constant<bool, Owning>());
   }
 
   // Returns the position of the minimum element in the range [l, r) of the input data
@@ -74,13 +59,121 @@ struct rmq_direct {  // 0-based
                    in_block_query(y, y * BlockSize, r), data);
   }
 
+  // Owning mode only: same as above over the values copied at construction
+  int operator()(int l, int r) const { return (*this)(l, r, value_view{Cells.data()}); }
+
+  // Owning mode only: returns the stored value at position i
+  const T& operator[](int i) const { return Cells[i].value; }
+
+  // Writes out[i] = (*this)(l[i], r[i], data) for i in [0, q), split across `threads` workers
+  template <typename Iter>
+  void batch(const int* l, const int* r, int* out, int q, const Iter& data, int threads = 1) const {
+    parallel_for(0, q, threads, [&](int lo, int hi) { batch_range(l, r, out, lo, hi, data); });
+  }
+
+  // Owning mode only: batch over the values copied at construction
+  void batch(const int* l, const int* r, int* out, int q, int threads = 1) const {
+    batch(l, r, out, q, value_view{Cells.data()}, threads);
+  }
+
   private:
+  static const int BlockSize = 8 * sizeof(Mask);
+  static const int PREFETCH_DISTANCE = 16, MIN_WORK_PER_THREAD = 1 << 14;
+
+  struct mask_cell {
+    Mask mask;
+  };
+  struct owned_cell {
+    Mask mask;
+    T value;
+  };
+  typedef typename std::conditional<Owning, owned_cell, mask_cell>::type cell;
+
+  // Indexable view over the values interleaved in `Cells`
+  struct value_view {
+    const cell* c;
+    const T& operator[](int i) const { return c[i].value; }
+  };
+
   int n;
   Compare comp;
-  int BlockSize;
   int TotalBlocks;
   std::vector<int> BlocksRMQ;
-  std::vector<int> Masks;
+  std::vector<cell> Cells;
+
+  template <typename Iter>
+  void build(Iter first, int threads, std::false_type) {
+    build_tables(first, threads);
+  }
+
+  template <typename Iter>
+  void build(Iter first, int threads, std::true_type) {
+    parallel_for(0, n, threads, [&](int lo, int hi) {
+      for (int i = lo; i < hi; ++i) Cells[i].value = first[i];
+    });
+    build_tables(value_view{Cells.data()}, threads);
+  }
+
+  // One monotonic-stack pass per block yields its masks and (stack bottom) its minimum
+  template <typename Iter>
+  void build_tables(const Iter& first, int threads) {
+    parallel_for(0, TotalBlocks, threads, [&](int lo, int hi) {
+      int stk[BlockSize];
+      for (int block = lo; block < hi; ++block) {
+        const int i = block * BlockSize, end = std::min(n, i + BlockSize);
+        int top = 0;
+        for (int j = i; j < end; ++j) {
+          while (top > 0 && comp(first[j], first[stk[top - 1]])) --top;
+          if (top > 0) Cells[j].mask = Cells[stk[top - 1]].mask | (Mask(1) << (stk[top - 1] - i));
+          stk[top++] = j;
+        }
+        BlocksRMQ[block] = stk[0];
+      }
+    });
+    for (int lvl = 0, mh = 1; (mh << 1) <= TotalBlocks; ++lvl, mh <<= 1) {
+      const int* cur_lvl = &BlocksRMQ[TotalBlocks * lvl];
+      int* next_lvl = &BlocksRMQ[TotalBlocks * (lvl + 1)];
+      parallel_for(0, TotalBlocks - mh, threads, [&](int lo, int hi) {
+        for (int i = lo; i < hi; ++i) next_lvl[i] = arg_min(cur_lvl[i], cur_lvl[i + mh], first);
+      });
+    }
+  }
+
+  // Runs f(lo, hi) over contiguous chunks of [begin, end) on up to `threads` workers
+  template <typename F>
+  static void parallel_for(int begin, int end, int threads, const F& f) {
+    threads = std::max(1, std::min(threads, (end - begin) / MIN_WORK_PER_THREAD));
+    if (threads == 1) {
+      if (begin < end) f(begin, end);
+      return;
+    }
+    std::vector<std::thread> pool;
+    for (int t = 0; t < threads; ++t) {
+      const int lo = begin + static_cast<long long>(end - begin) * t / threads;
+      const int hi = begin + static_cast<long long>(end - begin) * (t + 1) / threads;
+      pool.emplace_back([=, &f]() { f(lo, hi); });
+    }
+    for (auto& th : pool) th.join();
+  }
+
+  // Keeps the masks and block-table entries of query i + PREFETCH_DISTANCE in flight
+  template <typename Iter>
+  void batch_range(const int* l, const int* r, int* out, int lo, int hi, const Iter& data) const {
+    for (int i = lo; i < hi; ++i) {
+      if (i + PREFETCH_DISTANCE < hi) {
+        const int pl = l[i + PREFETCH_DISTANCE], pr = r[i + PREFETCH_DISTANCE] - 1;
+        const int x = pl / BlockSize, y = pr / BlockSize;
+        __builtin_prefetch(&Cells[pr]);
+        if (y > x) __builtin_prefetch(&Cells[x * BlockSize + BlockSize - 1]);
+        if (y - x >= 2) {
+          const int z = std::__lg(y - x - 1);
+          __builtin_prefetch(&BlocksRMQ[TotalBlocks * z + x + 1]);
+          __builtin_prefetch(&BlocksRMQ[TotalBlocks * z + y - (1 << z)]);
+        }
+      }
+      out[i] = (*this)(l[i], r[i], data);
+    }
+  }
 
   template <typename Iter>
   inline int arg_min(int x, int y, const Iter& data) const {
@@ -88,17 +181,20 @@ struct rmq_direct {  // 0-based
   }
 
   int in_block_query(int block, int l, int r) const {
-    int r_mask = Masks[r], pos = l - BlockSize * block;
-    if (pos >= 1) r_mask &= ~((1 << pos) - 1);
+    Mask r_mask = Cells[r].mask;
+    const int pos = l - BlockSize * block;
+    if (pos >= 1) r_mask &= ~((Mask(1) << pos) - 1);
     if (r_mask == 0) return r;
-    const int ret = std::__lg(lowest_one(r_mask));
-    return ret + block * BlockSize;
+    return ctz(r_mask) + block * BlockSize;
   }
 
-  static inline size_t lowest_one(const size_t x) { return x & -x; }
+  static inline int ctz(unsigned int x) { return __builtin_ctz(x); }
+  static inline int ctz(unsigned long long x) { return __builtin_ctzll(x); }
 };
 
-#ifdef LOCAL
+#endif  // RMQ_DIRECT_CPP
+
+#if defined(LOCAL) && __INCLUDE_LEVEL__ == 0  // Demo only when compiled directly
 #include <iostream>
 using namespace std;
 
@@ -0,0 +1,114 @@
+// =============================================================================
+// @author     Jose A. Romero (jromero132)
+// @algorithm  Sparse Table & Disjoint Sparse Table
+// @docs       Static range-aggregate tables over 0-based, half-open [l, r)
+//             queries (l < r) returning the aggregated value. Both keep one
+//             flat level-major vector like `rmq_direct`'s block table.
+//             `sparse_table` needs an idempotent operation (min, max, gcd,
+//             and, or) and answers with two overlapping power-of-two
+//             windows. `disjoint_sparse_table` accepts any associative
+//             operation (sum, product, matrix product, ...) by storing, per
+//             level, suffix/prefix aggregates around each block midpoint.
+// @time       Preprocessing: $O(N \log N)$, Query: $O(1)$ with one (sparse)
+//             or at most one (disjoint) application of the operation
+// @space      $O(N \log N)$
+// =============================================================================
+
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+template <typename T, typename Op>
+struct sparse_table {  // 0-based, Op must be idempotent
+  sparse_table() = default;
+
+  template <typename Iter>
+  sparse_table(Iter first, Iter last, const Op& op = Op())
+      : n(std::distance(first, last)), op(op), table(first, last) {
+    table.resize(static_cast<size_t>(std::__lg(std::max(n, 1)) + 1) * n);
+    for (int k = 1; (1 << k) <= n; ++k) {
+      const T* prev = &table[static_cast<size_t>(k - 1) * n];
+      T* cur = &table[static_cast<size_t>(k) * n];
+      for (int i = 0, h = 1 << (k - 1); i + (1 << k) <= n; ++i) cur[i] = op(prev[i], prev[i + h]);
+    }
+  }
+
+  // Returns op over the range [l, r)
+  T operator()(int l, int r) const {
+    const int k = std::__lg(r - l);
+    const T* lvl = &table[static_cast<size_t>(k) * n];
+    return op(lvl[l], lvl[r - (1 << k)]);
+  }
+
+  private:
+  int n;
+  Op op;
+  std::vector<T> table;
+};
+
+template <typename T, typename Op>
+struct disjoint_sparse_table {  // 0-based, Op must be associative
+  disjoint_sparse_table() = default;
+
+  template <typename Iter>
+  disjoint_sparse_table(Iter first, Iter last, const Op& op = Op())
+      : n(std::distance(first, last)), op(op), values(first, last) {
+    const int levels = n > 1 ? std::__lg(n - 1) + 1 : 0;
+    table.resize(static_cast<size_t>(levels) * n);
+    for (int h = 0; h < levels; ++h) {
+      T* lvl = &table[static_cast<size_t>(h) * n];
+      for (int mid = 1 << h; mid < n; mid += 2 << h) {
+        lvl[mid - 1] = values[mid - 1];
+        for (int i = mid - 2; i >= mid - (1 << h); --i) lvl[i] = op(values[i], lvl[i + 1]);
+        lvl[mid] = values[mid];
+        const int end = std::min(n, mid + (1 << h));
+        for (int i = mid + 1; i < end; ++i) lvl[i] = op(lvl[i - 1], values[i]);
+      }
+    }
+  }
+
+  // Returns op over the range [l, r), folded left to right
+  T operator()(int l, int r) const {
+    if (--r == l) return values[l];
+    const T* lvl = &table[static_cast<size_t>(std::__lg(l ^ r)) * n];
+    return op(lvl[l], lvl[r]);
+  }
+
+  private:
+  int n;
+  Op op;
+  std::vector<T> values, table;
+};
+
+#ifdef LOCAL
+#include <iostream>
+using namespace std;
+
+struct gcd_op {
+  long long operator()(long long a, long long b) const { return b ? (*this)(b, a % b) : a; }
+};
+
+struct sum_op {
+  long long operator()(long long a, long long b) const { return a + b; }
+};
+
+int main() {
+  vector<long long> a = {12, 18, 24, 7, 14, 21, 30};
+  sparse_table<long long, gcd_op> gcd_table(a.begin(), a.end());
+  disjoint_sparse_table<long long, sum_op> sum_table(a.begin(), a.end());
+
+  for (int l = 0; l < a.size(); ++l) {
+    long long g = 0, s = 0;
+    for (int r = l + 1; r <= a.size(); ++r) {
+      g = gcd_op()(g, a[r - 1]);
+      s += a[r - 1];
+      long long rg = gcd_table(l, r), rs = sum_table(l, r);
+      cout << "Range [" << l << ", " << r << "): gcd " << rg << " (Expected: " << g << "), sum "
+           << rs << " (Expected: " << s << ")";
+      if (rg != g || rs != s) cout << " [ERROR]";
+      cout << endl;
+    }
+  }
+  return 0;
+}
+#endif
@@ -0,0 +1,235 @@
+// =============================================================================
+// @author     Jose A. Romero (jromero132)
+// @algorithm  Succinct Range Minimum Query (Balanced Parentheses)
+// @docs       Argmin over 0-based, half-open [l, r) (l < r) like `rmq_direct`,
+//             but answered from ~3.2 bits/element without the original data.
+//             The build runs the monotonic stack once and writes ')' per pop
+//             and '(' per push: a 2N-bit parentheses encoding of the
+//             Cartesian tree. The i-th '(' belongs to element i, and the
+//             argmin of [l, r] is the element pushed right after the last
+//             minimum of the stack height (excess) between the '(' of l and
+//             the '(' of r, or l itself if the height never drops below l's.
+//             Select is a two-level directory over groups of 1024 '(': a
+//             group spanning 2^16 bits or more stores every position, and a
+//             shorter one stores the offset of every 64th '('; such a run of
+//             64 is stored in full if it spans 4096 bits or more, and is
+//             otherwise finished by walking at most 17 per-block rank
+//             counts. Min-excess scans partial 256-bit blocks a byte at a
+//             time and hands whole blocks to an `rmq_direct` over block
+//             minima. Ties go to the leftmost position.
+// @time       Preprocessing: $O(N)$, Query: $O(1)$ (at most ~150 table steps)
+// @space      $2N + o(N)$ bits
+// =============================================================================
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <vector>
+
+#include "rmq_direct.cpp"
+
+struct succinct_rmq {  // 0-based
+  succinct_rmq() = default;
+
+  template <typename Iter,
+            typename Compare = std::less<typename std::iterator_traits<Iter>::value_type>>
+  succinct_rmq(Iter first, Iter last, const Compare& comp = Compare())
+      : n(std::distance(first, last)) {
+    words.assign((2LL * n + 63) / 64 + 1, 0);
+    std::vector<int> stk;
+    int len = 0;
+    for (int i = 0; i < n; ++i) {
+      while (!stk.empty() && comp(first[i], first[stk.back()])) stk.pop_back(), ++len;
+      words[len >> 6] |= 1ULL << (len & 63);
+      ++len;
+      stk.push_back(i);
+    }
+    words.resize((len + 63) / 64);
+    words.shrink_to_fit();
+
+    const int blocks = (len + BLOCK_BITS - 1) / BLOCK_BITS;
+    rank.assign(blocks + 1, 0);
+    block_min.assign(blocks, 0);
+    for (int b = 0; b < blocks; ++b) {
+      int at = -1, ones = 0;
+      block_min[b] = len;
+      scan(b * BLOCK_BITS, std::min(len, (b + 1) * BLOCK_BITS) - 1, excess_before(b),
+           block_min[b], at);
+      for (int w = b * WORDS; w < std::min<int>(words.size(), (b + 1) * WORDS); ++w) {
+        ones += __builtin_popcountll(words[w]);
+      }
+      rank[b + 1] = rank[b] + ones;
+    }
+    if (!block_min.empty()) rmq = decltype(rmq)(block_min.begin(), block_min.end());
+
+    groups.reserve((n + SAMPLE - 1) / SAMPLE);
+    sub.reserve(groups.capacity() * (SAMPLE / SUB));
+    std::vector<int> pos;  // Positions of the '(' of the group being filled
+    pos.reserve(SAMPLE);
+    for (int w = 0; w < static_cast<int>(words.size()); ++w) {
+      for (unsigned long long x = words[w]; x; x &= x - 1) {
+        pos.push_back(w * 64 + __builtin_ctzll(x));
+        if (static_cast<int>(pos.size()) == SAMPLE) add_group(pos), pos.clear();
+      }
+    }
+    if (!pos.empty()) add_group(pos);
+    exact.shrink_to_fit();
+    sub_exact.shrink_to_fit();
+  }
+
+  // Returns the position of the minimum element in the range [l, r) of the input data
+  int operator()(int l, int r) const {
+    if (--r == l) return l;
+    const int pl = select(l), pr = select(r), start = 2 * l - pl + 1;  // Excess after '(' of l
+    const int bl = (pl + 1) / BLOCK_BITS, br = pr / BLOCK_BITS;
+    int best = start, at = pl;
+    if (bl == br) {
+      scan(pl + 1, pr, start, best, at);
+    } else {
+      scan(pl + 1, bl * BLOCK_BITS + BLOCK_BITS - 1, start, best, at);
+      if (br - bl >= 2) {
+        const int b = rmq(bl + 1, br, block_min);
+        if (block_min[b] <= best) {
+          scan(b * BLOCK_BITS, b * BLOCK_BITS + BLOCK_BITS - 1, excess_before(b), best, at);
+        }
+      }
+      scan(br * BLOCK_BITS, pr, excess_before(br), best, at);
+    }
+    return best == start ? l : (best + at + 1) / 2;  // Number of '(' up to `at`
+  }
+
+  int size() const { return n; }
+
+  private:
+  static const int BLOCK_BITS = 256, WORDS = BLOCK_BITS / 64;
+  static const int SAMPLE = 1024, SUB = 64, SPARSE_GROUP = 1 << 16, SPARSE_SUB = 4096;
+
+  struct select_group {
+    int first;              // Position of the group's first '('
+    int at;                 // ~index into `exact` if sparse, else index into `sub_exact`
+    unsigned short sparse;  // Bit j: the j-th run of SUB '(' is stored in `sub_exact`
+  };
+
+  // Per byte (bits in stream order): net excess, minimum running excess, last position of it
+  struct byte_tables {
+    signed char delta[256], low[256], pos[256];
+    byte_tables() {
+      for (int v = 0; v < 256; ++v) {
+        int e = 0;
+        low[v] = 8;
+        for (int i = 0; i < 8; ++i) {
+          e += v >> i & 1 ? 1 : -1;
+          if (e <= low[v]) low[v] = e, pos[v] = i;
+        }
+        delta[v] = e;
+      }
+    }
+  };
+
+  int n;
+  std::vector<unsigned long long> words;  // Bit 1 = '(', bit 0 = ')'
+  std::vector<int> rank;                   // Number of '(' before each block
+  std::vector<int> block_min;              // Minimum excess reached inside each block
+  std::vector<select_group> groups;        // One per SAMPLE '('
+  std::vector<int> exact;                  // Every '(' of sparse groups
+  std::vector<unsigned short> sub;         // Offset of every SUB-th '(' in its group
+  std::vector<unsigned short> sub_exact;   // Offset of every '(' of sparse runs
+  rmq_direct<int, std::less_equal<int>, false, unsigned int> rmq;  // Rightmost block minimum
+
+  static const byte_tables& tables() {
+    static const byte_tables t;
+    return t;
+  }
+
+  // Stack height right before the first bit of block b
+  inline int excess_before(int b) const { return 2 * rank[b] - b * BLOCK_BITS; }
+
+  inline int bit(int p) const { return words[p >> 6] >> (p & 63) & 1; }
+
+  // Lowers `best` to the minimum excess after each bit of [lo, hi] (starting from excess e),
+  // keeping in `at` the last position that attains it
+  void scan(int lo, int hi, int e, int& best, int& at) const {
+    const byte_tables& t = tables();
+    for (; lo <= hi && (lo & 7); ++lo) {
+      e += bit(lo) ? 1 : -1;
+      if (e <= best) best = e, at = lo;
+    }
+    for (; lo + 7 <= hi; lo += 8) {
+      const int v = words[lo >> 6] >> (lo & 63) & 255;
+      if (e + t.low[v] <= best) best = e + t.low[v], at = lo + t.pos[v];
+      e += t.delta[v];
+    }
+    for (; lo <= hi; ++lo) {
+      e += bit(lo) ? 1 : -1;
+      if (e <= best) best = e, at = lo;
+    }
+  }
+
+  // Appends the select directory entry of a group of at most SAMPLE '(' at positions `pos`
+  void add_group(const std::vector<int>& pos) {
+    const int m = pos.size();
+    select_group g = {pos[0], 0, 0};
+    if (pos[m - 1] - pos[0] >= SPARSE_GROUP) {
+      g.at = ~static_cast<int>(exact.size());
+      exact.insert(exact.end(), pos.begin(), pos.end());
+    } else {
+      g.at = sub_exact.size();
+      for (int j = 0, s = 0; s < m; ++j, s += SUB) {
+        const int e = std::min(m, s + SUB);
+        sub.push_back(pos[s] - pos[0]);
+        if (pos[e - 1] - pos[s] < SPARSE_SUB) continue;
+        g.sparse |= 1 << j;
+        for (int t = s; t < e; ++t) sub_exact.push_back(pos[t] - pos[0]);
+      }
+    }
+    sub.resize(groups.size() * (SAMPLE / SUB) + SAMPLE / SUB);
+    groups.push_back(g);
+  }
+
+  // Position of the k-th '(' (0-based)
+  int select(int k) const {
+    const select_group& g = groups[k / SAMPLE];
+    const int i = k % SAMPLE, j = i / SUB;
+    if (g.at < 0) return exact[~g.at + i];
+    if (g.sparse >> j & 1) {
+      const int runs = __builtin_popcount(g.sparse & ((1u << j) - 1));  // Sparse runs before j
+      return g.first + sub_exact[g.at + runs * SUB + i % SUB];
+    }
+    // The k-th '(' lies less than SPARSE_SUB bits after the first '(' of its run
+    int b = (g.first + sub[k / SUB]) / BLOCK_BITS;
+    while (rank[b + 1] <= k) ++b;
+    k -= rank[b];
+    for (int w = b * WORDS;; ++w) {
+      const int c = __builtin_popcountll(words[w]);
+      if (k < c) {
+        unsigned long long x = words[w];
+        while (k--) x &= x - 1;
+        return w * 64 + __builtin_ctzll(x);
+      }
+      k -= c;
+    }
+  }
+};
+
+#ifdef LOCAL
+#include <iostream>
+using namespace std;
+
+int main() {
+  vector<int> a = {4, 1, 8, 2, 9, 0, 3};
+  succinct_rmq rmq(a.begin(), a.end());
+
+  for (int i = 0; i < a.size(); ++i) {
+    int min_idx = i;
+    for (int j = i + 1; j <= a.size(); ++j) {
+      min_idx = a[j - 1] < a[min_idx] ? j - 1 : min_idx;
+      int idx = rmq(i, j);
+      cout << "Minimum index in range [" << i << ", " << j << "): " << idx;
+      cout << " (Expected: " << min_idx << ", Value: " << a[min_idx] << ")";
+      if (idx != min_idx) cout << " [ERROR]";
+      cout << endl;
+    }
+  }
+  return 0;
+}
+#endif
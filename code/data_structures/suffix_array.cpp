@@ -0,0 +1,158 @@
+// =============================================================================
+// @author     Jose A. Romero (jromero132)
+// @algorithm  Suffix Array (SA-IS) + LCP (Kasai) with O(1) LCP Queries
+// @docs       Builds the suffix array of a byte string by induced sorting
+//             (SA-IS), the inverse `rank` array, and Kasai's `height` array
+//             (height[k] = LCP of suffixes sa[k-1] and sa[k], height[0] = 0).
+//             `lcp(i, j)` returns the longest common prefix of the suffixes
+//             starting at positions i and j through a non-owning
+//             `rmq_direct` over `height`. The top level of SA-IS reads the
+//             text as bytes; only the reduced LMS problems use ints.
+// @time       Preprocessing: $O(N + \sigma)$, Query: $O(1)$
+// @space      $O(N)$, ~21 bytes per character (sa, rank, height, masks)
+// =============================================================================
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "rmq_direct.cpp"
+
+struct suffix_array {  // 0-based
+  std::vector<int> sa, rank, height;
+
+  suffix_array() = default;
+
+  suffix_array(const std::string& s) : rank(s.size()), height(s.size(), 0), n(s.size()) {
+    sa = sa_is(std::vector<unsigned char>(s.begin(), s.end()), 255);
+    for (int k = 0; k < n; ++k) rank[sa[k]] = k;
+    for (int i = 0, h = 0; i < n; ++i) {
+      if (h > 0) --h;
+      if (rank[i] == 0) continue;
+      const int j = sa[rank[i] - 1];
+      while (i + h < n && j + h < n && s[i + h] == s[j + h]) ++h;
+      height[rank[i]] = h;
+    }
+    if (n >= 2) rmq = rmq_direct<int>(height.begin(), height.end());  // lcp(i != j) needs n >= 2
+  }
+
+  int size() const { return n; }
+
+  // Returns the length of the longest common prefix of the suffixes starting at i and j
+  int lcp(int i, int j) const {
+    if (i == j) return n - i;
+    int a = rank[i], b = rank[j];
+    if (a > b) std::swap(a, b);
+    return height[rmq(a + 1, b + 1, height)];
+  }
+
+  private:
+  int n;
+  rmq_direct<int> rmq;
+
+  // Suffix array of s over the alphabet [0, upper]
+  template <typename Vec>
+  static std::vector<int> sa_is(const Vec& s, int upper) {
+    const int n = s.size();
+    if (n == 0) return std::vector<int>();
+    if (n == 1) return std::vector<int>(1, 0);
+
+    std::vector<int> sa(n);
+    std::vector<char> ls(n, 0);  // 1 = S-type: s[i..] < s[i+1..]
+    for (int i = n - 2; i >= 0; --i) ls[i] = s[i] == s[i + 1] ? ls[i + 1] : s[i] < s[i + 1];
+
+    // sum_l[c] / sum_s[c]: first slot of the L-type / S-type part of bucket c
+    std::vector<int> sum_l(upper + 1, 0), sum_s(upper + 1, 0);
+    for (int i = 0; i < n; ++i) {
+      if (!ls[i]) ++sum_s[s[i]];
+      else ++sum_l[s[i] + 1];
+    }
+    for (int c = 0; c <= upper; ++c) {
+      sum_s[c] += sum_l[c];
+      if (c < upper) sum_l[c + 1] += sum_s[c];
+    }
+
+    std::vector<int> buf(upper + 1);
+    auto induce = [&](const std::vector<int>& lms) {
+      std::fill(sa.begin(), sa.end(), -1);
+      std::copy(sum_s.begin(), sum_s.end(), buf.begin());
+      for (int d : lms) sa[buf[s[d]]++] = d;
+      std::copy(sum_l.begin(), sum_l.end(), buf.begin());
+      sa[buf[s[n - 1]]++] = n - 1;
+      for (int i = 0; i < n; ++i) {
+        const int v = sa[i];
+        if (v >= 1 && !ls[v - 1]) sa[buf[s[v - 1]]++] = v - 1;
+      }
+      std::copy(sum_l.begin(), sum_l.end(), buf.begin());
+      for (int i = n - 1; i >= 0; --i) {
+        const int v = sa[i];
+        if (v >= 1 && ls[v - 1]) sa[--buf[s[v - 1] + 1]] = v - 1;
+      }
+    };
+
+    std::vector<int> lms_map(n, -1), lms;
+    for (int i = 1; i < n; ++i) {
+      if (!ls[i - 1] && ls[i]) {
+        lms_map[i] = lms.size();
+        lms.push_back(i);
+      }
+    }
+    const int m = lms.size();
+    induce(lms);
+    if (m == 0) return sa;
+
+    // Name the LMS substrings in sorted order and recurse if any two share a name
+    std::vector<int> sorted_lms;
+    sorted_lms.reserve(m);
+    for (int v : sa) {
+      if (lms_map[v] != -1) sorted_lms.push_back(v);
+    }
+    std::vector<int> rec_s(m);
+    int rec_upper = 0;
+    rec_s[lms_map[sorted_lms[0]]] = 0;
+    for (int k = 1; k < m; ++k) {
+      int l = sorted_lms[k - 1], r = sorted_lms[k];
+      const int end_l = lms_map[l] + 1 < m ? lms[lms_map[l] + 1] : n;
+      const int end_r = lms_map[r] + 1 < m ? lms[lms_map[r] + 1] : n;
+      bool same = end_l - l == end_r - r;
+      if (same) {
+        while (l < end_l && s[l] == s[r]) ++l, ++r;
+        same = l < n && s[l] == s[r];
+      }
+      rec_s[lms_map[sorted_lms[k]]] = rec_upper += !same;
+    }
+    std::vector<int>().swap(lms_map);
+
+    const std::vector<int> rec_sa = sa_is(rec_s, rec_upper);
+    for (int k = 0; k < m; ++k) sorted_lms[k] = lms[rec_sa[k]];
+    induce(sorted_lms);
+    return sa;
+  }
+};
+
+#ifdef LOCAL
+#include <iostream>
+using namespace std;
+
+int main() {
+  string s = "banana";
+  suffix_array sa(s);
+
+  vector<int> expected_sa = {5, 3, 1, 0, 4, 2}, expected_height = {0, 1, 3, 0, 0, 2};
+  for (int k = 0; k < s.size(); ++k) {
+    cout << "sa[" << k << "] = " << sa.sa[k] << " (" << s.substr(sa.sa[k]) << "), height "
+         << sa.height[k] << " (Expected: " << expected_sa[k] << ", " << expected_height[k] << ")";
+    if (sa.sa[k] != expected_sa[k] || sa.height[k] != expected_height[k]) cout << " [ERROR]";
+    cout << endl;
+  }
+
+  int queries[][3] = {{1, 3, 3}, {0, 1, 0}, {2, 4, 2}, {5, 1, 1}, {2, 2, 4}};
+  for (auto& q : queries) {
+    int res = sa.lcp(q[0], q[1]);
+    cout << "lcp(" << q[0] << ", " << q[1] << "): " << res << " (Expected: " << q[2] << ")";
+    if (res != q[2]) cout << " [ERROR]";
+    cout << endl;
+  }
+  return 0;
+}
+#endif
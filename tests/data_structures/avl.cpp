@@ -3,13 +3,24 @@
 // @unit_test  AVL Tree Test Suite
 // @docs       Validates logarithmic self-balancing cycles (LL, RR, LR, RL
 //             rotations), duplicate key rejection, order statistics queries
-//             (kth element & order_of_key), and custom object comparison
-//             safety.
+//             (kth element & order_of_key), custom object comparison
+//             safety, pooled node recycling through erase, clear, scope
+//             exit and moves, and structural invariants (heights, sizes,
+//             balance) under randomized inserts and erases, bidirectional
+//             iterators, key ranges and the in-order visitor, and O(N) bulk
+//             loads, join and split, and the (optionally parallel) union,
+//             intersection and difference.
 // =============================================================================
 
 #include "../../code/data_structures/avl.cpp"
 
+#include <algorithm>
+#include <iterator>
+#include <random>
+#include <set>
+#include <sstream>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "../doctest.h"
@@ -27,6 +38,19 @@ struct CustomItem {
   bool operator>=(const CustomItem& o) const { return id >= o.id; }
 };
 
+namespace avl_test {
+// Returns the height of u's subtree, or -1 if any height, size, order or balance is off
+int checked_height(const avl<int>& t, const avl<int>::node* u, const int* lo, const int* hi) {
+  if (u == t.null) return 0;
+  if ((lo && u->key <= *lo) || (hi && u->key >= *hi)) return -1;
+  const int l = checked_height(t, u->ch[0], lo, &u->key);
+  const int r = checked_height(t, u->ch[1], &u->key, hi);
+  if (l < 0 || r < 0 || l - r > 1 || r - l > 1) return -1;
+  if (u->h != 1 + std::max(l, r) || u->sz != 1 + u->ch[0]->sz + u->ch[1]->sz) return -1;
+  return u->h;
+}
+}  // namespace avl_test
+
 TEST_SUITE("AVL Tree Suite") {
   TEST_CASE("Basic Tree Mechanics") {
     avl<int> tree;
@@ -109,6 +133,208 @@ TEST_SUITE("AVL Tree Suite") {
     }
   }
 
+  TEST_CASE("Pooled Nodes: Clear, Reuse and Move") {
+    avl<int> tree;
+    for (int round = 0; round < 3; ++round) {
+      for (int i = 0; i < 10000; ++i) tree.insert((i * 7919) % 10000);
+      for (int i = 0; i < 10000; i += 2) tree.erase(i);
+      CHECK(tree.size() == 5000);
+      CHECK(tree.kth(0) == 1);
+      CHECK(tree.kth(4999) == 9999);
+      tree.clear();
+      CHECK(tree.size() == 0);
+      CHECK(tree.in_order().empty());
+    }
+
+    {
+      avl<int> scoped({3, 1, 2});  // Returns its nodes to the shared pool on scope exit
+      tree.insert(4);
+    }
+    CHECK(tree.in_order() == std::vector<int>{4});
+
+    avl<int> moved(std::move(tree));
+    CHECK(moved.in_order() == std::vector<int>{4});
+    CHECK(tree.size() == 0);
+    tree = std::move(moved);
+    CHECK(tree.find(4));
+  }
+
+  TEST_CASE("Randomized Inserts and Erases Against std::set") {
+    using namespace avl_test;
+    std::mt19937 rng(47);
+    avl<int> tree;
+    std::set<int> ref;
+    for (int step = 0; step < 20000; ++step) {
+      const int key = rng() % 500;
+      if (rng() % 3) {
+        tree.insert(key);
+        ref.insert(key);
+      } else {
+        tree.erase(key);
+        ref.erase(key);
+      }
+      if (step % 97 == 0) {
+        REQUIRE(checked_height(tree, tree.root, nullptr, nullptr) >= 0);
+        REQUIRE(tree.size() == static_cast<int>(ref.size()));
+      }
+    }
+    CHECK(checked_height(tree, tree.root, nullptr, nullptr) >= 0);
+    CHECK(tree.in_order() == std::vector<int>(ref.begin(), ref.end()));
+    const int below = std::distance(ref.begin(), ref.lower_bound(250));
+    CHECK(tree.order_of_key(250) == below);
+  }
+
+  TEST_CASE("Iterators, Ranges and Streaming Visitor") {
+    avl<int> tree;
+    CHECK(tree.begin() == tree.end());
+    CHECK(tree.range(0, 10).begin() == tree.range(0, 10).end());
+
+    std::mt19937 rng(48);
+    std::set<int> ref;
+    for (int i = 0; i < 3000; ++i) {
+      const int key = rng() % 5000;
+      tree.insert(key);
+      ref.insert(key);
+    }
+    const std::vector<int> sorted(ref.begin(), ref.end());
+
+    SUBCASE("Forward and Backward Iteration") {
+      CHECK(std::vector<int>(tree.begin(), tree.end()) == sorted);
+
+      std::vector<int> backward;
+      for (avl<int>::iterator it = tree.end(); it != tree.begin();) backward.push_back(*--it);
+      CHECK(std::vector<int>(backward.rbegin(), backward.rend()) == sorted);
+
+      avl<int>::iterator it = tree.begin();
+      ++it, ++it, --it;
+      CHECK(*it == sorted[1]);
+      CHECK(*std::prev(tree.end()) == sorted.back());
+      CHECK(std::distance(tree.begin(), tree.end()) == tree.size());
+    }
+
+    SUBCASE("Visitor Matches in_order") {
+      std::vector<int> visited;
+      tree.for_each_in_order([&visited](int key) { visited.push_back(key); });
+      CHECK(visited == sorted);
+      CHECK(tree.in_order() == sorted);
+    }
+
+    SUBCASE("Half-Open Key Ranges") {
+      for (int q = 0; q < 200; ++q) {
+        int lo = rng() % 5200 - 100, hi = rng() % 5200 - 100;
+        if (lo > hi) std::swap(lo, hi);
+        std::vector<int> got;
+        for (int key : tree.range(lo, hi)) got.push_back(key);
+        CHECK(got == std::vector<int>(ref.lower_bound(lo), ref.lower_bound(hi)));
+      }
+      CHECK(tree.lower_bound(sorted.back() + 1) == tree.end());
+      CHECK(*tree.lower_bound(sorted[0]) == sorted[0]);
+    }
+  }
+
+  TEST_CASE("Bulk Load, Join and Split") {
+    using namespace avl_test;
+
+    SUBCASE("Sorted and Unsorted Bulk Loads") {
+      for (int n : {0, 1, 2, 7, 8, 1000, 1023, 1024}) {
+        std::vector<int> keys(n);
+        for (int i = 0; i < n; ++i) keys[i] = 3 * i;
+        avl<int> tree(keys);
+        int height = 0;
+        while ((1 << height) <= n) ++height;  // Perfectly balanced: ceil(log2(n + 1)) levels
+        CHECK(checked_height(tree, tree.root, nullptr, nullptr) == height);
+        CHECK(tree.in_order() == keys);
+      }
+
+      std::istringstream sorted_in("1 2 3 4"), messy_in("5 3 1 9");  // Single-pass input
+      avl<int> from_sorted((std::istream_iterator<int>(sorted_in)), std::istream_iterator<int>());
+      avl<int> from_messy((std::istream_iterator<int>(messy_in)), std::istream_iterator<int>());
+      CHECK(from_sorted.in_order() == std::vector<int>{1, 2, 3, 4});
+      CHECK(from_messy.in_order() == std::vector<int>{1, 3, 5, 9});
+
+      std::vector<int> messy = {5, 3, 9, 3, 1, 9, 7};
+      avl<int> tree(messy.begin(), messy.end());
+      CHECK(tree.in_order() == std::vector<int>{1, 3, 5, 7, 9});
+      CHECK(checked_height(tree, tree.root, nullptr, nullptr) >= 0);
+    }
+
+    SUBCASE("Join Trees of Very Different Heights") {
+      std::mt19937 rng(49);
+      for (int round = 0; round < 60; ++round) {
+        const int nl = rng() % (round < 30 ? 40 : 3000), nr = rng() % (round < 30 ? 3000 : 40);
+        std::vector<int> left(nl), right(nr), all;
+        for (int i = 0; i < nl; ++i) left[i] = i;
+        for (int i = 0; i < nr; ++i) right[i] = nl + 1 + i;
+        for (int i = 0; i <= nl + nr; ++i) all.push_back(i);
+
+        avl<int> a(left), b(right);
+        for (int i = 0; i < nl; i += 3) a.erase(i);  // Make the left tree irregular
+        for (int i = 0; i < nl; i += 3) all.erase(std::find(all.begin(), all.end(), i));
+
+        avl<int> joined = avl<int>::join(std::move(a), nl, std::move(b));
+        REQUIRE(checked_height(joined, joined.root, nullptr, nullptr) >= 0);
+        CHECK(joined.in_order() == all);
+        CHECK(a.size() == 0);
+        CHECK(b.size() == 0);
+      }
+    }
+
+    SUBCASE("Split at Present and Absent Keys") {
+      std::vector<int> keys;
+      for (int i = 0; i < 2000; ++i) keys.push_back(2 * i);
+      for (int key : {-5, 0, 1, 2, 777, 778, 3998, 3999, 5000}) {
+        avl<int> lo(keys);
+        avl<int> hi = lo.split(key);
+        REQUIRE(checked_height(lo, lo.root, nullptr, nullptr) >= 0);
+        REQUIRE(checked_height(hi, hi.root, nullptr, nullptr) >= 0);
+        const int cut = std::lower_bound(keys.begin(), keys.end(), key) - keys.begin();
+        CHECK(lo.in_order() == std::vector<int>(keys.begin(), keys.begin() + cut));
+        CHECK(hi.in_order() == std::vector<int>(keys.begin() + cut, keys.end()));
+        CHECK(hi.order_of_key(key) == 0);
+        CHECK(lo.size() + hi.size() == 2000);
+      }
+    }
+  }
+
+  TEST_CASE("Join-Based Set Operations") {
+    using namespace avl_test;
+    std::mt19937 rng(50);
+    for (int size : {0, 1, 300, 40000}) {
+      for (int threads : {1, 4}) {
+        std::set<int> sa, sb;
+        for (int i = 0; i < size; ++i) sa.insert(rng() % (3 * size + 1));
+        for (int i = 0; i < size / 2 + 1; ++i) sb.insert(rng() % (3 * size + 1));
+        const std::vector<int> va(sa.begin(), sa.end()), vb(sb.begin(), sb.end());
+        std::vector<int> expected;
+
+        avl<int> a(va), b(vb);
+        avl<int> u = avl<int>::set_union(std::move(a), std::move(b), threads);
+        std::set_union(va.begin(), va.end(), vb.begin(), vb.end(), std::back_inserter(expected));
+        REQUIRE(checked_height(u, u.root, nullptr, nullptr) >= 0);
+        CHECK(u.in_order() == expected);
+        CHECK(a.size() + b.size() == 0);
+
+        expected.clear();
+        avl<int> c(va), d(vb);
+        avl<int> i = avl<int>::set_intersection(std::move(c), std::move(d), threads);
+        std::set_intersection(va.begin(), va.end(), vb.begin(), vb.end(),
+                              std::back_inserter(expected));
+        REQUIRE(checked_height(i, i.root, nullptr, nullptr) >= 0);
+        CHECK(i.in_order() == expected);
+        CHECK(c.size() + d.size() == 0);
+
+        expected.clear();
+        avl<int> e(va), f(vb);
+        avl<int> diff = avl<int>::set_difference(std::move(e), std::move(f), threads);
+        std::set_difference(va.begin(), va.end(), vb.begin(), vb.end(),
+                            std::back_inserter(expected));
+        REQUIRE(checked_height(diff, diff.root, nullptr, nullptr) >= 0);
+        CHECK(diff.in_order() == expected);
+        CHECK(e.size() + f.size() == 0);
+      }
+    }
+  }
+
   TEST_CASE("Custom Type Inclusions Evaluation") {
     avl<CustomItem> tree;
     tree.insert({100, "Alice"});
@@ -0,0 +1,62 @@
+// =============================================================================
+// @author     Jose A. Romero (jromero132)
+// @unit_test  Blocked Bloom Filter Test Suite
+// @docs       Validates the no-false-negative guarantee, empirical
+//             false-positive rates against the configured target, clearing,
+//             configuration extremes, and string keys.
+// =============================================================================
+
+#include "../../code/data_structures/bloom_filter.cpp"
+
+#include <string>
+
+#include "../doctest.h"
+
+TEST_SUITE("Bloom Filter Suite") {
+  TEST_CASE("Membership Guarantees") {
+    const int n = 50000;
+    bloom_filter<long long> bf(n, 0.01);
+    for (int i = 0; i < n; ++i) bf.insert(3LL * i);
+
+    SUBCASE("Inserted keys are always reported") {
+      int misses = 0;
+      for (int i = 0; i < n; ++i) misses += !bf.may_contain(3LL * i);
+      CHECK(misses == 0);
+    }
+
+    SUBCASE("False-positive rate stays near the target") {
+      int hits = 0;
+      for (int i = 0; i < n; ++i) hits += bf.may_contain(3LL * i + 1);
+      CHECK(hits < n * 15 / 1000);
+    }
+
+    SUBCASE("Clear empties the filter") {
+      bf.clear();
+      int hits = 0;
+      for (int i = 0; i < 1000; ++i) hits += bf.may_contain(3LL * i);
+      CHECK(hits == 0);
+    }
+  }
+
+  TEST_CASE("Configuration Extremes") {
+    SUBCASE("Zero expected keys still yields a usable filter") {
+      bloom_filter<int> bf(0);
+      CHECK(bf.may_contain(7) == false);
+      bf.insert(7);
+      CHECK(bf.may_contain(7) == true);
+    }
+
+    SUBCASE("Looser targets use fewer hash functions") {
+      CHECK(bloom_filter<int>(100, 0.1).hash_count() < bloom_filter<int>(100, 0.001).hash_count());
+    }
+  }
+
+  TEST_CASE("String Keys") {
+    bloom_filter<std::string> bf(100, 0.01);
+    bf.insert("apple");
+    bf.insert("banana");
+    CHECK(bf.may_contain("apple") == true);
+    CHECK(bf.may_contain("banana") == true);
+    CHECK(bf.may_contain("durian") == false);
+  }
+}
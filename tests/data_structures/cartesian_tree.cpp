@@ -0,0 +1,109 @@
+// =============================================================================
+// @author     Jose A. Romero (jromero132)
+// @unit_test  Cartesian Tree Test Suite
+// @docs       Validates parent/left/right links and the root on hand-checked
+//             arrays, leftmost tie-breaking, custom comparators, empty input,
+//             traversal order and ranges, a 10^6-deep sorted input, const
+//             pointer ranges, and randomized parity of every subtree root with
+//             brute-force argmin.
+// =============================================================================
+
+#include "../../code/data_structures/cartesian_tree.cpp"
+
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <vector>
+
+#include "../doctest.h"
+
+TEST_SUITE("Cartesian Tree Suite") {
+  TEST_CASE("Hand-Checked Links") {
+    std::vector<int> a = {4, 1, 8, 2, 9, 0, 3};
+    cartesian_tree ct(a.begin(), a.end());
+
+    CHECK(ct.root == 5);
+    CHECK(ct.parent == std::vector<int>({1, 5, 3, 1, 3, -1, 5}));
+    CHECK(ct.left == std::vector<int>({-1, 0, -1, 2, -1, 1, -1}));
+    CHECK(ct.right == std::vector<int>({-1, 3, -1, 4, -1, 6, -1}));
+  }
+
+  TEST_CASE("Ties Keep the Leftmost Element Higher") {
+    std::vector<int> a = {2, 2, 2};
+    cartesian_tree ct(a.begin(), a.end());
+    CHECK(ct.root == 0);
+    CHECK(ct.parent == std::vector<int>({-1, 0, 1}));
+  }
+
+  TEST_CASE("Max-Cartesian Tree and Empty Input") {
+    std::vector<int> a = {1, 5, 3};
+    cartesian_tree ct(a.begin(), a.end(), std::greater<int>());
+    CHECK(ct.root == 1);
+    CHECK(ct.left[1] == 0);
+    CHECK(ct.right[1] == 2);
+
+    std::vector<int> empty;
+    cartesian_tree none(empty.begin(), empty.end());
+    int visits = 0;
+    none.preorder([&](int, int, int) { ++visits; });
+    CHECK(none.root == -1);
+    CHECK(visits == 0);
+  }
+
+  TEST_CASE("Traversal Orders") {
+    std::vector<int> a = {4, 1, 8, 2, 9, 0, 3};
+    cartesian_tree ct(a.begin(), a.end());
+    std::vector<int> pre, post;
+    std::vector<int> lo(a.size()), hi(a.size());
+    ct.preorder([&](int v, int l, int r) { pre.push_back(v), lo[v] = l, hi[v] = r; });
+    ct.postorder([&](int v, int, int) { post.push_back(v); });
+
+    CHECK(pre == std::vector<int>({5, 1, 0, 3, 2, 4, 6}));
+    CHECK(post == std::vector<int>({0, 2, 4, 3, 1, 6, 5}));
+    CHECK(lo == std::vector<int>({0, 0, 2, 2, 4, 0, 6}));
+    CHECK(hi == std::vector<int>({1, 5, 3, 5, 5, 7, 7}));
+  }
+
+  TEST_CASE("Deep Tree Without Recursion") {
+    const int n = 1000000;
+    std::vector<int> a(n);
+    for (int i = 0; i < n; ++i) a[i] = n - i;  // A single left path
+    cartesian_tree ct(a.begin(), a.end());
+
+    long long covered = 0;
+    ct.postorder([&](int, int l, int r) { covered += r - l; });
+    CHECK(ct.root == n - 1);
+    CHECK(covered == 1LL * n * (n + 1) / 2);
+  }
+
+  TEST_CASE("Construction from a const Pointer Range") {
+    const int a[] = {4, 1, 8, 2, 9, 0, 3};
+    const int* first = a;
+    cartesian_tree ct(first, first + 7);
+    CHECK(ct.root == 5);
+    CHECK(ct.parent == std::vector<int>({1, 5, 3, 1, 3, -1, 5}));
+  }
+
+  TEST_CASE("Randomized Parity with Brute Force") {
+    std::mt19937 rng(23);
+    std::uniform_int_distribution<int> digit(0, 9);
+    for (int iter = 0; iter < 50; ++iter) {
+      const int n = std::uniform_int_distribution<int>(1, 200)(rng);
+      std::vector<int> a(n);
+      for (int& x : a) x = digit(rng);
+      cartesian_tree ct(a.begin(), a.end());
+
+      int visits = 0;
+      ct.preorder([&](int v, int l, int r) {
+        CAPTURE(iter);
+        CAPTURE(l);
+        CAPTURE(r);
+        CHECK(v == std::min_element(a.begin() + l, a.begin() + r) - a.begin());
+        const int p = ct.parent[v];
+        CHECK((p == -1 || ct.left[p] == v || ct.right[p] == v));
+        ++visits;
+      });
+      CHECK(visits == n);
+    }
+  }
+}
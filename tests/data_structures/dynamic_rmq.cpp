@@ -0,0 +1,91 @@
+// =============================================================================
+// @author     Jose A. Romero (jromero132)
+// @unit_test  Dynamic Range Minimum Query Test Suite
+// @docs       Validates half-open argmin queries before and after point
+//             updates, leftmost tie-breaking, non-power-of-two sizes, custom
+//             maximum comparators, pointer-range construction, and randomized
+//             parity with brute force.
+// =============================================================================
+
+#include "../../code/data_structures/dynamic_rmq.cpp"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "../doctest.h"
+
+TEST_SUITE("Dynamic RMQ Suite") {
+  TEST_CASE("Static Queries Match rmq_direct Conventions") {
+    std::vector<int> a = {5, 2, 7, 8, 2, 9};
+    dynamic_rmq<int> rmq(a.begin(), a.end());
+
+    CHECK(rmq(0, 1) == 0);
+    CHECK(rmq(0, 6) == 1);  // Leftmost of the tied minima
+    CHECK(rmq(2, 6) == 4);
+    CHECK(rmq(5, 6) == 5);
+    CHECK(rmq[3] == 8);
+  }
+
+  TEST_CASE("Point Updates") {
+    std::vector<int> a = {9, 8, 7, 6, 5};
+    dynamic_rmq<int> rmq(a.begin(), a.end());
+    REQUIRE(rmq(0, 5) == 4);
+
+    SUBCASE("Lowering a value moves the minimum") {
+      rmq.update(1, -3);
+      CHECK(rmq(0, 5) == 1);
+      CHECK(rmq(2, 5) == 4);
+      CHECK(rmq[1] == -3);
+    }
+
+    SUBCASE("Raising the minimum hands over to the runner-up") {
+      rmq.update(4, 100);
+      CHECK(rmq(0, 5) == 3);
+    }
+
+    SUBCASE("Creating a tie prefers the left position") {
+      rmq.update(0, 5);
+      CHECK(rmq(0, 5) == 0);
+    }
+  }
+
+  TEST_CASE("Range Maximum with Custom Comparator") {
+    std::vector<long long> a = {3, 10, 4};
+    dynamic_rmq<long long, std::greater<long long>> rmq(a.begin(), a.end());
+    CHECK(rmq(0, 3) == 1);
+    rmq.update(2, 11);
+    CHECK(rmq(0, 3) == 2);
+  }
+
+  TEST_CASE("Construction from a Pointer Range") {
+    const int a[] = {4, 1, 3, 1, 0, 2};
+    dynamic_rmq<int> rmq(a, a + 6);
+    CHECK(rmq(0, 4) == 1);
+    CHECK(rmq(0, 6) == 4);
+    CHECK(rmq[2] == 3);
+  }
+
+  TEST_CASE("Randomized Parity with Brute Force") {
+    const int n = 37;  // Not a power of two
+    std::mt19937 rng(2024);
+    std::uniform_int_distribution<int> value(0, 19), pos(0, n - 1);
+    std::vector<int> a(n);
+    for (int i = 0; i < n; ++i) a[i] = value(rng);
+    dynamic_rmq<int> rmq(a.begin(), a.end());
+
+    for (int step = 0; step < 2000; ++step) {
+      const int i = pos(rng);
+      a[i] = value(rng);
+      rmq.update(i, a[i]);
+
+      const int l = pos(rng);
+      const int r = std::uniform_int_distribution<int>(l + 1, n)(rng);
+      const int best = std::min_element(a.begin() + l, a.begin() + r) - a.begin();
+      CAPTURE(step);
+      CAPTURE(l);
+      CAPTURE(r);
+      CHECK(rmq(l, r) == best);
+    }
+  }
+}
@@ -0,0 +1,105 @@
+// =============================================================================
+// @author     Jose A. Romero (jromero132)
+// @unit_test  Hash Set & Dense Bit-Vector Set Test Suite
+// @docs       Validates duplicate rejection, collision chains, erase patching,
+//             O(1) reuse via clear(), live-key iteration, string keys, and
+//             bit-packed membership across word boundaries with negative
+//             universes.
+// =============================================================================
+
+#include "../../code/data_structures/hash_set.cpp"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "../doctest.h"
+
+TEST_SUITE("Hash Set Suite") {
+  TEST_CASE("Chained Membership Operations") {
+    hash_set<int> hs;
+    const int colliding = 10 + hash_set<int>::MOD;
+
+    CHECK(hs.find(10) == false);
+    CHECK(hs.insert(10) == true);
+    CHECK(hs.insert(10) == false);  // Duplicates are rejected
+    CHECK(hs.insert(colliding) == true);
+    CHECK(hs.insert(-10) == true);
+    CHECK(hs.size() == 3);
+
+    SUBCASE("Erasing inside a collision chain keeps its neighbours") {
+      hs.erase(colliding);
+      CHECK(hs.find(colliding) == false);
+      CHECK(hs.find(10) == true);
+      hs.erase(10);
+      CHECK(hs.find(10) == false);
+      CHECK(hs.size() == 1);
+    }
+
+    SUBCASE("Iteration visits exactly the live keys") {
+      hs.erase(10);
+      std::vector<int> keys;
+      for (int k : hs) keys.push_back(k);
+      std::sort(keys.begin(), keys.end());
+      CHECK(keys == std::vector<int>{-10, colliding});
+    }
+
+    SUBCASE("Clear forgets everything in constant time") {
+      hs.clear();
+      CHECK(hs.size() == 0);
+      CHECK(hs.find(10) == false);
+      CHECK(hs.find(colliding) == false);
+      CHECK(hs.begin() == hs.end());
+      CHECK(hs.insert(colliding) == true);
+      CHECK(hs.find(10) == false);
+    }
+  }
+
+  TEST_CASE("String Key Deduplication") {
+    hash_set<std::string> hs;
+    const char* words[] = {"to", "be", "or", "not", "to", "be"};
+    int distinct = 0;
+    for (const char* w : words) distinct += hs.insert(w);
+    CHECK(distinct == 4);
+    CHECK(hs.find("not") == true);
+    CHECK(hs.find("tea") == false);
+  }
+
+  TEST_CASE("Dense Bit-Vector Membership") {
+    dense_set ds(-64, 200);
+
+    SUBCASE("Universe boundaries and word crossings") {
+      CHECK(ds.insert(-64) == true);
+      CHECK(ds.insert(-1) == true);
+      CHECK(ds.insert(0) == true);
+      CHECK(ds.insert(199) == true);
+      CHECK(ds.insert(0) == false);
+      CHECK(ds.find(-64) == true);
+      CHECK(ds.find(-63) == false);
+      CHECK(ds.find(199) == true);
+      CHECK(ds.size() == 4);
+    }
+
+    SUBCASE("Erase and clear reset membership") {
+      ds.insert(5);
+      ds.insert(70);
+      ds.erase(5);
+      ds.erase(5);  // Erasing an absent key is a no-op
+      CHECK(ds.find(5) == false);
+      CHECK(ds.size() == 1);
+
+      ds.clear();
+      CHECK(ds.find(70) == false);
+      CHECK(ds.size() == 0);
+      CHECK(ds.insert(70) == true);
+    }
+
+    SUBCASE("Word emptied by erase is still cleared after refill") {
+      ds.insert(1);
+      ds.erase(1);
+      ds.insert(2);
+      ds.clear();
+      CHECK(ds.find(2) == false);
+    }
+  }
+}
@@ -2,16 +2,40 @@
 // @author     Jose A. Romero (jromero132)
 // @unit_test  Chained Hash Table Test Suite
 // @docs       Validates amortized O(1) map operations, entry re-writing, deep
-//             bucket collisions, deletion chain link patching, and modulo-safe
-//             negative signed integer key tracking.
+//             bucket collisions, deletion chain link patching, modulo-safe
+//             negative signed integer key tracking, O(1) reuse via clear(),
+//             iteration over live entries, and non-integral keys with custom
+//             hashers where cached hashes screen out key comparisons, and
+//             single-probe upserts (operator[], try_emplace, update).
 // =============================================================================
 
 #include "../../code/data_structures/hash_table.cpp"
 
+#include <algorithm>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "../doctest.h"
 
+// Hashes pairs by mixing both halves; intentionally weak to exercise equality checks
+struct PairHasher {
+  size_t operator()(const std::pair<int, int>& k) const { return k.first * 31 + k.second; }
+};
+
+// Sends every key to bucket 0 with a distinct full hash, counting equality calls
+struct SameBucketHasher {
+  size_t operator()(int k) const { return static_cast<size_t>(k) * hash_table<int, int>::MOD; }
+};
+
+struct CountingEqual {
+  int* calls;
+  bool operator()(int a, int b) const {
+    ++*calls;
+    return a == b;
+  }
+};
+
 TEST_SUITE("Hash Table Suite") {
   TEST_CASE("Basic Key Operations") {
     hash_table<int, std::string> ht;
@@ -93,4 +117,147 @@ TEST_SUITE("Hash Table Suite") {
       CHECK(*head_node == 'Y');
     }
   }
+
+  TEST_CASE("Reuse Across Test Cases via clear()") {
+    hash_table<int, int> ht;
+    ht.set(1, 10);
+    ht.set(1 + hash_table<int, int>::MOD, 20);
+    ht.set(-7, 30);
+    REQUIRE(ht.size() == 3);
+
+    ht.clear();
+    CHECK(ht.size() == 0);
+    CHECK(ht.find(1) == nullptr);
+    CHECK(ht.find(1 + hash_table<int, int>::MOD) == nullptr);
+    CHECK(ht.find(-7) == nullptr);
+    CHECK(ht.begin() == ht.end());
+
+    SUBCASE("Previously used buckets start empty chains") {
+      ht.set(1, 11);
+      REQUIRE(ht.find(1) != nullptr);
+      CHECK(*ht.find(1) == 11);
+      CHECK(ht.find(1 + hash_table<int, int>::MOD) == nullptr);
+      CHECK(ht.size() == 1);
+    }
+
+    SUBCASE("Many consecutive clears stay independent") {
+      for (int round = 0; round < 100; ++round) {
+        ht.set(round, round);
+        CHECK(ht.find(round - 1) == nullptr);
+        CHECK(*ht.find(round) == round);
+        ht.clear();
+      }
+    }
+  }
+
+  TEST_CASE("Iteration Over Live Entries") {
+    hash_table<int, char> ht;
+    const int colliding = 3 + hash_table<int, char>::MOD;
+    ht.set(3, 'a');
+    ht.set(colliding, 'b');
+    ht.set(-9, 'c');
+    ht.set(3, 'd');  // Rewrite must not duplicate the entry
+    ht.erase(colliding);
+
+    std::vector<std::pair<int, char>> seen;
+    for (auto e : ht) seen.push_back(std::make_pair(e.first, e.second));
+    std::sort(seen.begin(), seen.end());
+
+    CHECK(ht.size() == 2);
+    CHECK(seen == std::vector<std::pair<int, char>>{{-9, 'c'}, {3, 'd'}});
+
+    SUBCASE("Values are writable through the iterator") {
+      for (auto e : ht) e.second = 'z';
+      CHECK(*ht.find(3) == 'z');
+      CHECK(*ht.find(-9) == 'z');
+    }
+
+    SUBCASE("Erasing everything leaves an empty range") {
+      ht.erase(3);
+      ht.erase(-9);
+      CHECK(ht.size() == 0);
+      CHECK(ht.begin() == ht.end());
+    }
+  }
+
+  TEST_CASE("Non-Integral Keys and Custom Hashers") {
+    SUBCASE("String keys through std::hash") {
+      hash_table<std::string, int> ht;
+      ht.set("alpha", 1);
+      ht.set("beta", 2);
+      ht.set("alpha", 3);
+      REQUIRE(ht.find("alpha") != nullptr);
+      CHECK(*ht.find("alpha") == 3);
+      CHECK(*ht.find("beta") == 2);
+      CHECK(ht.find("gamma") == nullptr);
+      ht.erase("alpha");
+      CHECK(ht.find("alpha") == nullptr);
+      CHECK(ht.size() == 1);
+    }
+
+    SUBCASE("Pair keys whose hashes collide keep distinct entries") {
+      hash_table<std::pair<int, int>, char, PairHasher> ht;
+      ht.set({0, 31}, 'a');  // 0 * 31 + 31 == 31
+      ht.set({1, 0}, 'b');   // 1 * 31 + 0 == 31
+      REQUIRE(ht.find({0, 31}) != nullptr);
+      REQUIRE(ht.find({1, 0}) != nullptr);
+      CHECK(*ht.find({0, 31}) == 'a');
+      CHECK(*ht.find({1, 0}) == 'b');
+      CHECK(ht.find({2, -31}) == nullptr);
+    }
+
+    SUBCASE("Cached hashes skip key comparisons on mismatching chain entries") {
+      int calls = 0;
+      CountingEqual eq = {&calls};
+      hash_table<int, int, SameBucketHasher, CountingEqual> ht(SameBucketHasher(), eq);
+      for (int k = 1; k <= 50; ++k) ht.set(k, k);  // One chain of 50 entries
+
+      calls = 0;
+      CHECK(ht.find(1000) == nullptr);
+      CHECK(calls == 0);
+      REQUIRE(ht.find(1) != nullptr);  // Tail of the chain
+      CHECK(calls == 1);
+    }
+  }
+
+  TEST_CASE("Single-Probe Upserts and Aggregation") {
+    hash_table<std::string, int> ht;
+
+    SUBCASE("operator[] default-inserts and returns a writable reference") {
+      CHECK(ht["x"] == 0);
+      ht["x"] += 5;
+      ++ht["x"];
+      CHECK(*ht.find("x") == 6);
+      CHECK(ht.size() == 1);
+    }
+
+    SUBCASE("try_emplace never overwrites an existing value") {
+      std::pair<int*, bool> first = ht.try_emplace("k", 1);
+      CHECK(first.second == true);
+      CHECK(*first.first == 1);
+      std::pair<int*, bool> second = ht.try_emplace("k", 2);
+      CHECK(second.second == false);
+      CHECK(second.first == first.first);
+      CHECK(*ht.find("k") == 1);
+    }
+
+    SUBCASE("update sums by default and accepts custom combiners") {
+      const char* words[] = {"a", "b", "a", "c", "a", "b"};
+      for (const char* w : words) ht.update(w, 1);
+      CHECK(*ht.find("a") == 3);
+      CHECK(*ht.find("b") == 2);
+      CHECK(*ht.find("c") == 1);
+
+      ht.update("a", 10, [](int x, int y) { return std::max(x, y); });
+      ht.update("a", 7, [](int x, int y) { return std::max(x, y); });
+      CHECK(*ht.find("a") == 10);
+      CHECK(ht.update("b", 3, std::multiplies<int>()) == 6);
+    }
+
+    SUBCASE("Reinsertion after erase starts from a fresh value") {
+      ht.update("z", 4);
+      ht.erase("z");
+      CHECK(ht["z"] == 0);
+    }
+  }
 }
@@ -0,0 +1,88 @@
+// =============================================================================
+// @author     Jose A. Romero (jromero132)
+// @unit_test  Lowest Common Ancestor Test Suite
+// @docs       Validates both Euler-tour and lean (preorder) modes on small
+//             hand-checked trees, non-zero roots, a path deep enough to break
+//             a recursive DFS, and randomized parity with naive parent climbing.
+// =============================================================================
+
+#include "../../code/data_structures/lca.cpp"
+
+#include <random>
+#include <vector>
+
+#include "../doctest.h"
+
+namespace lca_test {
+std::vector<std::vector<int>> from_parents(const std::vector<int>& parent) {
+  std::vector<std::vector<int>> adj(parent.size());
+  for (int v = 0; v < static_cast<int>(parent.size()); ++v) {
+    if (parent[v] == -1) continue;
+    adj[v].push_back(parent[v]);
+    adj[parent[v]].push_back(v);
+  }
+  return adj;
+}
+}  // namespace lca_test
+
+TEST_SUITE("LCA Suite") {
+  using namespace lca_test;
+
+  TEST_CASE_TEMPLATE("Hand-Checked Tree", Tree, lca<false>, lca<true>) {
+    // 0 -> {1, 2, 3}, 1 -> {4, 5}, 3 -> {6}, 5 -> {7}
+    Tree t(from_parents({-1, 0, 0, 0, 1, 1, 3, 5}));
+
+    CHECK(t(4, 7) == 1);
+    CHECK(t(7, 4) == 1);
+    CHECK(t(7, 6) == 0);
+    CHECK(t(5, 7) == 5);  // Ancestor of the other
+    CHECK(t(2, 2) == 2);
+    CHECK(t(0, 7) == 0);
+  }
+
+  TEST_CASE_TEMPLATE("Single Vertex and Custom Root", Tree, lca<false>, lca<true>) {
+    Tree single(std::vector<std::vector<int>>(1));
+    CHECK(single(0, 0) == 0);
+
+    // Path 0 - 1 - 2 - 3 - 4 rooted at 2
+    Tree t(from_parents({-1, 0, 1, 2, 3}), 2);
+    CHECK(t(0, 4) == 2);
+    CHECK(t(0, 1) == 1);
+    CHECK(t(3, 4) == 3);
+  }
+
+  TEST_CASE_TEMPLATE("Deep Path Without Recursion", Tree, lca<false>, lca<true>) {
+    const int n = 1000000;
+    std::vector<int> parent(n);
+    for (int i = 0; i < n; ++i) parent[i] = i - 1;
+    Tree t(from_parents(parent));
+
+    CHECK(t(n - 1, n / 2) == n / 2);
+    CHECK(t(0, n - 1) == 0);
+  }
+
+  TEST_CASE_TEMPLATE("Randomized Parity with Parent Climbing", Tree, lca<false>, lca<true>) {
+    std::mt19937 rng(99);
+    for (int n : {2, 3, 64, 65, 500}) {
+      std::vector<int> parent(n, -1), depth(n, 0);
+      for (int v = 1; v < n; ++v) {
+        parent[v] = std::uniform_int_distribution<int>(0, v - 1)(rng);
+        depth[v] = depth[parent[v]] + 1;
+      }
+      Tree t(from_parents(parent));
+
+      std::uniform_int_distribution<int> vertex(0, n - 1);
+      for (int q = 0; q < 3000; ++q) {
+        const int u = vertex(rng), v = vertex(rng);
+        int a = u, b = v;  // Climb the deeper vertex, then both together
+        while (depth[a] > depth[b]) a = parent[a];
+        while (depth[b] > depth[a]) b = parent[b];
+        while (a != b) a = parent[a], b = parent[b];
+        CAPTURE(n);
+        CAPTURE(u);
+        CAPTURE(v);
+        CHECK(t(u, v) == a);
+      }
+    }
+  }
+}
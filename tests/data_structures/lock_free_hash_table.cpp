@@ -0,0 +1,101 @@
+// =============================================================================
+// @author     Jose A. Romero (jromero132)
+// @unit_test  Lock-Free Hash Table Test Suite
+// @docs       Validates single-threaded claim/lookup semantics, custom empty
+//             key markers (never found or inserted), negative keys,
+//             full-table rejection, and exact counter totals when many
+//             threads race `fetch_add` on a shared set of keys.
+// =============================================================================
+
+#include "../../code/data_structures/lock_free_hash_table.cpp"
+
+#include <thread>
+#include <vector>
+
+#include "../doctest.h"
+
+TEST_SUITE("Lock-Free Hash Table Suite") {
+  TEST_CASE("Single-Threaded Key Operations") {
+    lock_free_hash_table<long long, int> ht(16);
+
+    SUBCASE("Capacity is rounded up to a power of two") {
+      CHECK(ht.capacity() == 16);
+      CHECK(lock_free_hash_table<int, int>(17).capacity() == 32);
+    }
+
+    SUBCASE("Lookup on non-existent targets") {
+      CHECK(ht.find(7) == nullptr);
+    }
+
+    SUBCASE("Insert claims a default-initialized slot exactly once") {
+      std::atomic<int>* a = ht.insert(7);
+      REQUIRE(a != nullptr);
+      CHECK(a->load() == 0);
+      a->store(11);
+      CHECK(ht.insert(7) == a);
+      CHECK(ht.find(7) == a);
+      CHECK(ht.find(7)->load() == 11);
+    }
+
+    SUBCASE("fetch_add reports the previous value") {
+      int old = -1;
+      CHECK(ht.fetch_add(-3, 5, &old));
+      CHECK(old == 0);
+      CHECK(ht.fetch_add(-3, 2, &old));
+      CHECK(old == 5);
+      CHECK(ht.find(-3)->load() == 7);
+    }
+
+    SUBCASE("Filling every slot keeps all keys reachable") {
+      for (int k = 0; k < 16; ++k) ht.fetch_add(k * 1000003LL, k);
+      for (int k = 0; k < 16; ++k) {
+        REQUIRE(ht.find(k * 1000003LL) != nullptr);
+        CHECK(ht.find(k * 1000003LL)->load() == k);
+      }
+      CHECK(ht.find(42) == nullptr);  // Full wrap-around terminates
+
+      // New keys are rejected without touching the table; existing ones still update
+      CHECK(ht.insert(42) == nullptr);
+      CHECK_FALSE(ht.fetch_add(42, 1));
+      CHECK(ht.find(42) == nullptr);
+      int old = -1;
+      CHECK(ht.fetch_add(3 * 1000003LL, 10, &old));
+      CHECK(old == 3);
+    }
+  }
+
+  TEST_CASE("Custom Empty Key Marker") {
+    lock_free_hash_table<int, int> ht(8, -1);
+    ht.fetch_add(2147483647, 1);  // Default marker becomes a usable key
+    REQUIRE(ht.find(2147483647) != nullptr);
+    CHECK(ht.find(2147483647)->load() == 1);
+
+    // The marker itself is rejected everywhere, even while empty slots exist
+    CHECK(ht.find(-1) == nullptr);
+    CHECK(ht.insert(-1) == nullptr);
+    CHECK_FALSE(ht.fetch_add(-1, 5));
+    CHECK(lock_free_hash_table<int, int>(4).find(2147483647) == nullptr);
+  }
+
+  TEST_CASE("Concurrent Counter Aggregation") {
+    const int threads = 4, ops = 20000, keys = 257;
+    lock_free_hash_table<long long, long long> ht(1024);
+
+    std::vector<std::thread> pool;
+    for (int t = 0; t < threads; ++t) {
+      pool.emplace_back([&ht, t]() {
+        for (int i = 0; i < ops; ++i) ht.fetch_add((i + t) % keys, 1);
+      });
+    }
+    for (auto& th : pool) th.join();
+
+    long long total = 0;
+    for (int k = 0; k < keys; ++k) {
+      std::atomic<long long>* res = ht.find(k);
+      REQUIRE(res != nullptr);
+      total += res->load();
+    }
+    CHECK(total == 1LL * threads * ops);
+    CHECK(ht.find(keys) == nullptr);
+  }
+}
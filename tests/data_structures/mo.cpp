@@ -0,0 +1,123 @@
+// =============================================================================
+// @author     Jose A. Romero (jromero132)
+// @unit_test  Mo's Algorithm Test Suite
+// @docs       Validates that every query is answered exactly once with the
+//             window at its range, under Hilbert and block orders, for
+//             distinct counts (add/remove) and maximum frequency through the
+//             rollback variant, including empty and single-block ranges,
+//             against brute force.
+// =============================================================================
+
+#include "../../code/data_structures/mo.cpp"
+
+#include <algorithm>
+#include <random>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include "../doctest.h"
+
+namespace mo_test {
+// q uniformly random ranges [l, r) with 0 <= l <= r <= n, empty ones included
+std::vector<std::pair<int, int>> random_queries(int n, int q, std::mt19937& rng) {
+  std::vector<std::pair<int, int>> queries;
+  for (int i = 0; i < q; ++i) {
+    const int l = std::uniform_int_distribution<int>(0, n)(rng);
+    queries.push_back(std::make_pair(l, std::uniform_int_distribution<int>(l, n)(rng)));
+  }
+  return queries;
+}
+}  // namespace mo_test
+
+TEST_SUITE("Mo's Algorithm Suite") {
+  using namespace mo_test;
+
+  TEST_CASE("Window Matches Every Query") {
+    const int n = 50;
+    std::mt19937 rng(5);
+    const std::vector<std::pair<int, int>> queries = random_queries(n, 300, rng);
+    for (bool hilbert : {true, false}) {
+      CAPTURE(hilbert);
+      std::vector<int> in(n, 0), answered(queries.size(), 0);
+      mo::solve(
+          n, queries, [&](int i) { CHECK(in[i]++ == 0); }, [&](int i) { CHECK(--in[i] == 0); },
+          [&](int q) {
+            ++answered[q];
+            for (int i = 0; i < n; ++i) {
+              CAPTURE(q);
+              CAPTURE(i);
+              CHECK(in[i] == static_cast<int>(queries[q].first <= i && i < queries[q].second));
+            }
+          },
+          hilbert);
+      CHECK(std::count(answered.begin(), answered.end(), 1) == static_cast<int>(queries.size()));
+    }
+  }
+
+  TEST_CASE("Distinct Counts Under Both Orders") {
+    std::mt19937 rng(7);
+    const int n = 400;
+    std::vector<int> a(n);
+    for (int& x : a) x = std::uniform_int_distribution<int>(0, 29)(rng);
+    const std::vector<std::pair<int, int>> queries = random_queries(n, 1000, rng);
+
+    for (bool hilbert : {true, false}) {
+      std::vector<int> cnt(30, 0), res(queries.size());
+      int distinct = 0;
+      mo::solve(
+          n, queries, [&](int i) { distinct += cnt[a[i]]++ == 0; },
+          [&](int i) { distinct -= --cnt[a[i]] == 0; }, [&](int q) { res[q] = distinct; },
+          hilbert);
+
+      for (int q = 0; q < static_cast<int>(queries.size()); ++q) {
+        const int l = queries[q].first, r = queries[q].second;
+        CAPTURE(hilbert);
+        CAPTURE(l);
+        CAPTURE(r);
+        CHECK(res[q] == static_cast<int>(std::set<int>(a.begin() + l, a.begin() + r).size()));
+      }
+    }
+  }
+
+  TEST_CASE("Rollback Variant: Maximum Frequency") {
+    std::mt19937 rng(13);
+    const int n = 500;
+    std::vector<int> a(n);
+    for (int& x : a) x = std::uniform_int_distribution<int>(0, 19)(rng);
+    const std::vector<std::pair<int, int>> queries = random_queries(n, 1500, rng);
+
+    // Add-only state with an undo log
+    std::vector<int> cnt(20, 0), touched, res(queries.size(), -1);
+    int best = 0, saved_best = 0, saved_size = 0;
+    mo::solve_rollback(
+        n, queries,
+        [&](int i) {
+          best = std::max(best, ++cnt[a[i]]);
+          touched.push_back(a[i]);
+        },
+        [&](int q) { res[q] = best; },
+        [&]() { saved_best = best, saved_size = touched.size(); },
+        [&]() {
+          while (static_cast<int>(touched.size()) > saved_size) {
+            --cnt[touched.back()];
+            touched.pop_back();
+          }
+          best = saved_best;
+        },
+        [&]() {
+          while (!touched.empty()) --cnt[touched.back()], touched.pop_back();
+          best = 0;
+        });
+
+    for (int q = 0; q < static_cast<int>(queries.size()); ++q) {
+      const int l = queries[q].first, r = queries[q].second;
+      std::vector<int> freq(20, 0);
+      int expected = 0;
+      for (int i = l; i < r; ++i) expected = std::max(expected, ++freq[a[i]]);
+      CAPTURE(l);
+      CAPTURE(r);
+      CHECK(res[q] == expected);
+    }
+  }
+}
@@ -0,0 +1,108 @@
+// =============================================================================
+// @author     Jose A. Romero (jromero132)
+// @unit_test  Static Minimal Perfect Hash Table Test Suite
+// @docs       Validates that every build key maps to a distinct slot in
+//             [0, n), absent-key rejection, empty, singleton and small builds
+//             around the bucket size, repeated keys, negative and extreme
+//             keys, and in-place value rewrites.
+// =============================================================================
+
+#include "../../code/data_structures/perfect_hash_table.cpp"
+
+#include <climits>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../doctest.h"
+
+TEST_SUITE("Perfect Hash Table Suite") {
+  TEST_CASE("Empty and Singleton Builds") {
+    SUBCASE("Empty key set rejects every lookup") {
+      std::vector<std::pair<int, int>> none;
+      perfect_hash_table<int, int> pht(none.begin(), none.end());
+      CHECK(pht.size() == 0);
+      CHECK(pht.find(0) == nullptr);
+      CHECK(pht.index(0) == -1);
+    }
+
+    SUBCASE("Single key resolves to slot zero") {
+      std::vector<std::pair<int, std::string>> one = {{-7, "only"}};
+      perfect_hash_table<int, std::string> pht(one.begin(), one.end());
+      CHECK(pht.index(-7) == 0);
+      REQUIRE(pht.find(-7) != nullptr);
+      CHECK(*pht.find(-7) == "only");
+      CHECK(pht.find(7) == nullptr);
+    }
+  }
+
+  TEST_CASE("Small Tables Around the Bucket Size Boundaries") {
+    // LAMBDA = 5 keys per bucket: covers the single-bucket sizes and the first few bucket counts
+    for (int n : {0, 1, 2, 3, 4, 5, 6, 9, 10, 11, 14, 15, 16, 19, 20, 21}) {
+      std::vector<std::pair<int, int>> items;
+      for (int i = 0; i < n; ++i) items.push_back({i * 37 - 50, i});
+      perfect_hash_table<int, int> pht(items.begin(), items.end());
+      CHECK(pht.size() == n);
+
+      std::vector<char> used(n, 0);
+      bool ok = true;
+      for (const auto& item : items) {
+        const int idx = pht.index(item.first);
+        if (idx < 0 || idx >= n || used[idx]++) ok = false;
+        if (!pht.find(item.first) || *pht.find(item.first) != item.second) ok = false;
+      }
+      CHECK(ok);
+      CHECK(pht.find(1000) == nullptr);
+    }
+  }
+
+  TEST_CASE("Repeated Keys Keep Their First Value") {
+    std::vector<std::pair<int, int>> items = {{4, 0}, {9, 1}, {4, 2}, {-1, 3}, {9, 4}, {4, 5}};
+    perfect_hash_table<int, int> pht(items.begin(), items.end());
+    CHECK(pht.size() == 3);
+    REQUIRE(pht.find(4) != nullptr);
+    CHECK(*pht.find(4) == 0);
+    CHECK(*pht.find(9) == 1);
+    CHECK(*pht.find(-1) == 3);
+    CHECK(pht.index(4) != pht.index(9));
+
+    std::vector<std::pair<long long, int>> same(100, std::make_pair(7LL, 1));
+    perfect_hash_table<long long, int> single(same.begin(), same.end());
+    CHECK(single.size() == 1);
+    CHECK(single.index(7) == 0);
+  }
+
+  TEST_CASE("Minimal Perfect Mapping Over Large Key Sets") {
+    const int n = 20000;
+    std::vector<std::pair<long long, int>> items;
+    for (int i = 0; i < n; ++i) items.push_back({1LL * i * 1000003 - 10000000000LL, i});
+    items.push_back({LLONG_MIN, n});
+    items.push_back({LLONG_MAX, n + 1});
+    perfect_hash_table<long long, int> pht(items.begin(), items.end());
+
+    SUBCASE("Every key owns a distinct slot in [0, n)") {
+      std::vector<char> used(items.size(), 0);
+      bool ok = true;
+      for (const auto& item : items) {
+        const int idx = pht.index(item.first);
+        if (idx < 0 || idx >= pht.size() || used[idx]) ok = false;
+        if (idx >= 0) used[idx] = 1;
+        int* val = pht.find(item.first);
+        if (!val || *val != item.second) ok = false;
+      }
+      CHECK(ok);
+      CHECK(pht.size() == n + 2);
+    }
+
+    SUBCASE("Keys outside the build set are rejected") {
+      int false_hits = 0;
+      for (int i = 0; i < n; ++i) false_hits += pht.find(1LL * i * 1000003 + 1) != nullptr;
+      CHECK(false_hits == 0);
+    }
+
+    SUBCASE("Values are writable in place") {
+      *pht.find(LLONG_MIN) = -1;
+      CHECK(*pht.find(LLONG_MIN) == -1);
+    }
+  }
+}
@@ -0,0 +1,65 @@
+// =============================================================================
+// @author     Jose A. Romero (jromero132)
+// @unit_test  Range Distinct Count Test Suite
+// @docs       Validates the streaming interface (counts after every push),
+//             offline answers in arbitrary query order including empty and
+//             repeated ranges, non-integral values, and randomized parity
+//             with brute-force counting.
+// =============================================================================
+
+#include "../../code/data_structures/range_distinct.cpp"
+
+#include <random>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../doctest.h"
+
+TEST_SUITE("Range Distinct Suite") {
+  TEST_CASE("Streaming Counts") {
+    range_distinct stream(6, 4);
+    stream.push_back(2);
+    stream.push_back(3);
+    stream.push_back(2);
+    CHECK(stream.size() == 3);
+    CHECK(stream.count(0) == 2);
+    CHECK(stream.count(1) == 2);
+    CHECK(stream.count(2) == 1);
+    CHECK(stream.count(3) == 0);
+
+    stream.push_back(0);
+    stream.push_back(3);
+    CHECK(stream.count(0) == 3);
+    CHECK(stream.count(2) == 3);
+    CHECK(stream.count(4) == 1);
+  }
+
+  TEST_CASE("Offline Queries in Any Order") {
+    std::vector<std::string> a = {"x", "y", "x", "z", "y"};
+    std::vector<std::pair<int, int>> queries = {{0, 5}, {2, 2}, {1, 3}, {0, 5}, {3, 5}, {0, 1}};
+    CHECK(range_distinct::solve(a, queries) == std::vector<int>({3, 0, 2, 3, 2, 1}));
+  }
+
+  TEST_CASE("Randomized Parity with Brute Force") {
+    std::mt19937 rng(41);
+    const int n = 300;
+    std::vector<long long> a(n);
+    for (long long& x : a) x = 1000000007LL * std::uniform_int_distribution<int>(0, 24)(rng);
+
+    std::vector<std::pair<int, int>> queries;
+    for (int i = 0; i < 2000; ++i) {
+      const int l = std::uniform_int_distribution<int>(0, n)(rng);
+      queries.push_back(std::make_pair(l, std::uniform_int_distribution<int>(l, n)(rng)));
+    }
+
+    const std::vector<int> res = range_distinct::solve(a, queries);
+    for (int i = 0; i < static_cast<int>(queries.size()); ++i) {
+      const int l = queries[i].first, r = queries[i].second;
+      CAPTURE(l);
+      CAPTURE(r);
+      CHECK(res[i] == static_cast<int>(std::set<long long>(a.begin() + l, a.begin() + r).size()));
+    }
+  }
+}
@@ -0,0 +1,103 @@
+// =============================================================================
+// @author     Jose A. Romero (jromero132)
+// @unit_test  2D Range Minimum Query Test Suite
+// @docs       Validates half-open rectangle queries on a hand-checked grid,
+//             single rows/columns, grids with no rows or columns, pointer
+//             input, custom comparators, and randomized parity
+//             with brute force for the full (block = 1) and memory-bounded
+//             (block > 1, including row counts not divisible by the block)
+//             layouts.
+// =============================================================================
+
+#include "../../code/data_structures/rmq_2d.cpp"
+
+#include <functional>
+#include <random>
+#include <vector>
+
+#include "../doctest.h"
+
+namespace rmq_2d_test {
+// Checks random rectangles: the returned cell must lie inside and hold the brute-force minimum
+template <typename Compare = std::less<int>>
+void check_brute_force(const std::vector<int>& a, int rows, int cols, int block,
+                       std::mt19937& rng, const Compare& comp = Compare()) {
+  rmq_2d<int, Compare> rmq(a.begin(), rows, cols, comp, block);
+  for (int q = 0; q < 500; ++q) {
+    const int r1 = std::uniform_int_distribution<int>(0, rows - 1)(rng);
+    const int r2 = std::uniform_int_distribution<int>(r1 + 1, rows)(rng);
+    const int c1 = std::uniform_int_distribution<int>(0, cols - 1)(rng);
+    const int c2 = std::uniform_int_distribution<int>(c1 + 1, cols)(rng);
+    int expected = a[r1 * cols + c1];
+    for (int r = r1; r < r2; ++r) {
+      for (int c = c1; c < c2; ++c) {
+        if (comp(a[r * cols + c], expected)) expected = a[r * cols + c];
+      }
+    }
+    CAPTURE(rows);
+    CAPTURE(cols);
+    CAPTURE(block);
+    CAPTURE(r1);
+    CAPTURE(c1);
+    CAPTURE(r2);
+    CAPTURE(c2);
+    const std::pair<int, int> pos = rmq(r1, c1, r2, c2);
+    REQUIRE(pos.first >= r1);
+    REQUIRE(pos.first < r2);
+    REQUIRE(pos.second >= c1);
+    REQUIRE(pos.second < c2);
+    CHECK(a[pos.first * cols + pos.second] == expected);
+  }
+}
+}  // namespace rmq_2d_test
+
+TEST_SUITE("2D RMQ Suite") {
+  using namespace rmq_2d_test;
+
+  TEST_CASE("Hand-Checked Grid") {
+    std::vector<int> a = {5, 8, 7,  //
+                          3, 9, 6,  //
+                          9, 1, 4};
+    rmq_2d<int> rmq(a.begin(), 3, 3);
+
+    CHECK(rmq(0, 0, 3, 3) == std::make_pair(2, 1));
+    CHECK(rmq(0, 0, 2, 3) == std::make_pair(1, 0));
+    CHECK(rmq(0, 1, 2, 3) == std::make_pair(1, 2));
+    CHECK(rmq(0, 2, 1, 3) == std::make_pair(0, 2));
+    CHECK(rmq.at(2, 2) == 4);
+  }
+
+  TEST_CASE("Single Row and Single Column") {
+    std::vector<int> a = {4, 2, 6, 1, 3};
+    rmq_2d<int> wide(a.begin(), 1, 5), tall(a.begin(), 5, 1, std::less<int>(), 2);
+    CHECK(wide(0, 0, 1, 5) == std::make_pair(0, 3));
+    CHECK(wide(0, 0, 1, 3) == std::make_pair(0, 1));
+    CHECK(tall(0, 0, 5, 1) == std::make_pair(3, 0));
+    CHECK(tall(4, 0, 5, 1) == std::make_pair(4, 0));
+  }
+
+  TEST_CASE("Grids Without Cells") {
+    std::vector<int> a = {1, 2, 3};
+    for (int block : {1, 2}) {
+      rmq_2d<int> no_cols(a.begin(), 3, 0, std::less<int>(), block);
+      rmq_2d<int> no_rows(a.begin(), 0, 3, std::less<int>(), block);
+      rmq_2d<int> none(a.begin(), 0, 0, std::less<int>(), block);
+    }
+    const int* p = a.data();
+    rmq_2d<int> from_pointer(p, 1, 3);  // Raw pointers go through rmq_direct's std::distance
+    CHECK(from_pointer(0, 0, 1, 3) == std::make_pair(0, 0));
+  }
+
+  TEST_CASE("Randomized Parity with Brute Force") {
+    std::mt19937 rng(31);
+    for (int block : {1, 2, 3, 8}) {
+      for (int rows : {1, 7, 24, 33}) {
+        const int cols = std::uniform_int_distribution<int>(1, 40)(rng);
+        std::vector<int> a(rows * cols);
+        for (int& x : a) x = std::uniform_int_distribution<int>(0, 49)(rng);
+        check_brute_force(a, rows, cols, block, rng);
+        check_brute_force(a, rows, cols, block, rng, std::greater<int>());
+      }
+    }
+  }
+}
@@ -2,12 +2,17 @@
 // @author     Jose A. Romero (jromero132)
 // @unit_test  Direct Range Minimum Query (Fischer-Heun) Test Suite
 // @docs       Validates constant-time O(1) minimum lookups across micro-ranges,
-//             intra-block boundaries, inter-block crossings, and custom
-//             inverted functor logic (Range Maximum Queries).
+//             intra-block boundaries, inter-block crossings, custom
+//             inverted functor logic (Range Maximum Queries), pointer-range
+//             construction, and parity of the owning (values copied in) mode
+//             and both mask widths (32/64 element blocks) against a brute
+//             force, batched queries with and without worker threads, and
+//             multi-threaded construction.
 // =============================================================================
 
 #include "../../code/data_structures/rmq_direct.cpp"
 
+#include <random>
 #include <string>
 #include <vector>
 
@@ -96,4 +101,147 @@ TEST_SUITE("Direct RMQ Suite") {
       CHECK(rmq_max(0, 4, items) == 2);  // Returns index of weight 90
     }
   }
+
+  TEST_CASE("Construction from a Pointer Range") {
+    const int a[] = {6, 3, 8, 1, 9};
+    rmq_direct<int> rmq(a, a + 5);
+    rmq_direct<int, std::less<int>, true> own(a, a + 5);
+    CHECK(rmq(0, 3, a) == 1);
+    CHECK(rmq(0, 5, a) == 3);
+    CHECK(own(2, 5) == 3);
+  }
+
+  TEST_CASE("Owning Mode Parity") {
+    std::vector<int> a;
+    for (int i = 0; i < 300; ++i) a.push_back((i * 7919 + 13) % 101 - 50);
+
+    rmq_direct<int, std::less<int>, true> own(a.begin(), a.end());
+    rmq_direct<int> ref(a.begin(), a.end());
+
+    SUBCASE("Stored values mirror the input") {
+      for (int i = 0; i < 300; ++i) {
+        CAPTURE(i);
+        CHECK(own[i] == a[i]);
+      }
+    }
+
+    SUBCASE("All ranges agree with brute force and the non-owning layout") {
+      for (int l = 0; l < 300; ++l) {
+        int best = l;
+        for (int r = l + 1; r <= 300; ++r) {
+          if (a[r - 1] < a[best]) best = r - 1;
+          CAPTURE(l);
+          CAPTURE(r);
+          CHECK(a[own(l, r)] == a[best]);
+          CHECK(own(l, r) == ref(l, r, a));
+        }
+      }
+    }
+
+    SUBCASE("Owning copy survives the source being modified") {
+      std::vector<int> b = {3, 1, 2};
+      rmq_direct<int, std::less<int>, true> rmq(b.begin(), b.end());
+      b.assign(3, 0);
+      CHECK(rmq(0, 3) == 1);
+      CHECK(rmq(2, 3) == 2);
+    }
+
+    SUBCASE("Owning range maximum over custom types") {
+      std::vector<Request> items = {{50, "A"}, {10, "B"}, {90, "C"}, {5, "D"}};
+      rmq_direct<Request, std::greater<Request>, true> rmq(items.begin(), items.end());
+      CHECK(rmq(0, 4) == 2);
+      CHECK(rmq[rmq(0, 2)].tag == "A");
+    }
+  }
+
+  TEST_CASE("Mask Width and Block Size Selection") {
+    std::vector<long long> a;
+    for (int i = 0; i < 1000; ++i) a.push_back((i * 104729LL) % 997 - (i % 64 == 63 ? 2000 : 0));
+
+    rmq_direct<long long, std::less<long long>, false, unsigned int> rmq32(a.begin(), a.end());
+    rmq_direct<long long, std::less<long long>, false, unsigned long long> rmq64(a.begin(), a.end());
+
+    for (int l = 0; l < 1000; l += 7) {
+      int best = l;
+      for (int r = l + 1; r <= 1000; ++r) {
+        if (a[r - 1] < a[best]) best = r - 1;
+        CAPTURE(l);
+        CAPTURE(r);
+        CHECK(rmq32(l, r, a) == best);
+        CHECK(rmq64(l, r, a) == best);
+      }
+    }
+
+    SUBCASE("Block edges: last bit of a full 64-bit mask") {
+      CHECK(rmq64(0, 64, a) == 63);
+      CHECK(rmq64(1, 64, a) == 63);
+      CHECK(rmq32(32, 64, a) == 63);
+    }
+  }
+
+  TEST_CASE("Batched Query Evaluation") {
+    const int n = 5000, q = 100000;
+    std::vector<int> a(n), l(q), r(q);
+    std::mt19937 rng(12345);
+    for (int i = 0; i < n; ++i) a[i] = rng() >> 8;
+    for (int i = 0; i < q; ++i) {
+      l[i] = std::uniform_int_distribution<int>(0, n - 1)(rng);
+      r[i] = std::uniform_int_distribution<int>(l[i] + 1, n)(rng);
+    }
+
+    rmq_direct<int> rmq(a.begin(), a.end());
+    std::vector<int> expected(q);
+    for (int i = 0; i < q; ++i) expected[i] = rmq(l[i], r[i], a);
+
+    SUBCASE("Single-threaded batch matches scalar queries") {
+      std::vector<int> out(q, -1);
+      rmq.batch(l.data(), r.data(), out.data(), q, a);
+      CHECK(out == expected);
+    }
+
+    SUBCASE("Multi-threaded batch matches scalar queries") {
+      std::vector<int> out(q, -1);
+      rmq.batch(l.data(), r.data(), out.data(), q, a, 4);
+      CHECK(out == expected);
+    }
+
+    SUBCASE("Owning batch needs no data argument") {
+      rmq_direct<int, std::less<int>, true> own(a.begin(), a.end());
+      std::vector<int> out(q, -1);
+      own.batch(l.data(), r.data(), out.data(), q, 3);
+      CHECK(out == expected);
+    }
+
+    SUBCASE("Tiny and empty batches") {
+      int out = -1;
+      rmq.batch(l.data(), r.data(), &out, 1, a, 8);
+      CHECK(out == expected[0]);
+      rmq.batch(l.data(), r.data(), &out, 0, a, 8);
+      CHECK(out == expected[0]);
+    }
+  }
+
+  TEST_CASE("Multi-Threaded Construction") {
+    // Large enough for several workers: the parallel passes need >= 2^14 blocks per thread
+    const int n = (1 << 22) + 123;
+    std::vector<int> a(n);
+    std::mt19937 rng(987654321);
+    for (int i = 0; i < n; ++i) a[i] = rng() >> 12;
+
+    rmq_direct<int> seq(a.begin(), a.end());
+    rmq_direct<int> par(a.begin(), a.end(), std::less<int>(), 4);
+    rmq_direct<int, std::less<int>, true> par_own(a.begin(), a.end(), std::less<int>(), 3);
+
+    for (int k = 0; k < 20000; ++k) {
+      const int l = std::uniform_int_distribution<int>(0, n - 1)(rng);
+      const int r = std::uniform_int_distribution<int>(l + 1, n)(rng);
+      CAPTURE(l);
+      CAPTURE(r);
+      const int expected = seq(l, r, a);
+      CHECK(par(l, r, a) == expected);
+      CHECK(par_own(l, r) == expected);
+    }
+    CHECK(par(0, n, a) == seq(0, n, a));
+    CHECK(par(n - 1, n, a) == n - 1);
+  }
 }
@@ -0,0 +1,116 @@
+// =============================================================================
+// @author     Jose A. Romero (jromero132)
+// @unit_test  Sparse Table & Disjoint Sparse Table Test Suite
+// @docs       Validates half-open range queries for idempotent operations
+//             (min, gcd) and associative non-idempotent ones (sum, and
+//             left-to-right string concatenation), single-element and
+//             non-power-of-two sizes, pointer-range construction, and
+//             randomized parity with brute force.
+// =============================================================================
+
+#include "../../code/data_structures/sparse_table.cpp"
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../doctest.h"
+
+namespace sparse_table_test {
+struct min_op {
+  int operator()(int a, int b) const { return b < a ? b : a; }
+};
+
+struct gcd_op {
+  long long operator()(long long a, long long b) const { return b ? (*this)(b, a % b) : a; }
+};
+
+struct sum_op {
+  long long operator()(long long a, long long b) const { return a + b; }
+};
+
+struct concat_op {
+  std::string operator()(const std::string& a, const std::string& b) const { return a + b; }
+};
+
+struct mod_sum_op {  // Stateful operation
+  long long mod;
+  long long operator()(long long a, long long b) const { return (a + b) % mod; }
+};
+}  // namespace sparse_table_test
+
+TEST_SUITE("Sparse Table Suite") {
+  using namespace sparse_table_test;
+
+  TEST_CASE("Idempotent Queries") {
+    std::vector<long long> a = {12, 18, 24, 7, 14, 21, 30};
+    sparse_table<long long, gcd_op> st(a.begin(), a.end());
+
+    CHECK(st(0, 1) == 12);
+    CHECK(st(0, 3) == 6);
+    CHECK(st(3, 6) == 7);
+    CHECK(st(0, 7) == 1);
+    CHECK(st(5, 7) == 3);
+  }
+
+  TEST_CASE("Single Element") {
+    std::vector<int> a = {42};
+    sparse_table<int, min_op> st(a.begin(), a.end());
+    disjoint_sparse_table<long long, sum_op> dst(a.begin(), a.end());
+    CHECK(st(0, 1) == 42);
+    CHECK(dst(0, 1) == 42);
+  }
+
+  TEST_CASE("Disjoint Table Keeps Left-to-Right Order") {
+    std::vector<std::string> a = {"a", "b", "c", "d", "e", "f"};
+    disjoint_sparse_table<std::string, concat_op> dst(a.begin(), a.end());
+
+    CHECK(dst(0, 6) == "abcdef");
+    CHECK(dst(1, 4) == "bcd");
+    CHECK(dst(3, 5) == "de");
+    CHECK(dst(5, 6) == "f");
+  }
+
+  TEST_CASE("Stateful Operation") {
+    std::vector<long long> a = {5, 6, 7, 8};
+    disjoint_sparse_table<long long, mod_sum_op> dst(a.begin(), a.end(), mod_sum_op{10});
+    CHECK(dst(0, 4) == 6);
+    CHECK(dst(1, 3) == 3);
+  }
+
+  TEST_CASE("Construction from a Pointer Range") {
+    const int a[] = {6, 3, 8, 1, 9};
+    sparse_table<int, min_op> st(a, a + 5);
+    disjoint_sparse_table<long long, sum_op> dst(a, a + 5);
+    CHECK(st(0, 3) == 3);
+    CHECK(st(1, 5) == 1);
+    CHECK(dst(0, 5) == 27);
+    CHECK(dst(2, 4) == 9);
+  }
+
+  TEST_CASE("Randomized Parity with Brute Force") {
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<int> value(-500, 499);
+    for (int n = 1; n <= 70; ++n) {
+      std::vector<int> a(n);
+      for (int i = 0; i < n; ++i) a[i] = value(rng);
+      sparse_table<int, min_op> st(a.begin(), a.end());
+      disjoint_sparse_table<long long, sum_op> dst(a.begin(), a.end());
+
+      for (int l = 0; l < n; ++l) {
+        int mn = a[l];
+        long long sum = 0;
+        for (int r = l + 1; r <= n; ++r) {
+          mn = std::min(mn, a[r - 1]);
+          sum += a[r - 1];
+          CAPTURE(n);
+          CAPTURE(l);
+          CAPTURE(r);
+          CHECK(st(l, r) == mn);
+          CHECK(dst(l, r) == sum);
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,115 @@
+// =============================================================================
+// @author     Jose A. Romero (jromero132)
+// @unit_test  Succinct RMQ Test Suite
+// @docs       Validates empty input, half-open argmin queries with leftmost
+//             tie-breaking, custom comparators, pointer-range construction,
+//             sorted and constant inputs, pop runs long enough to take every
+//             select directory path, and randomized parity with brute force
+//             on arrays spanning many 256-bit blocks and select groups.
+// =============================================================================
+
+#include "../../code/data_structures/succinct_rmq.cpp"
+
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <vector>
+
+#include "../doctest.h"
+
+namespace succinct_rmq_test {
+// Checks random queries (a quarter unbounded, the rest at most 300 long) against a linear scan
+template <typename Compare = std::less<int>>
+void check_brute_force(const std::vector<int>& a, int queries, std::mt19937& rng,
+                       const Compare& comp = Compare()) {
+  succinct_rmq rmq(a.begin(), a.end(), comp);
+  const int n = a.size();
+  for (int q = 0; q < queries; ++q) {
+    const int l = std::uniform_int_distribution<int>(0, n - 1)(rng);
+    const int max_len = q % 4 == 0 ? n - l : std::min(n - l, 300);
+    const int r = l + std::uniform_int_distribution<int>(1, max_len)(rng);
+    int best = l;
+    for (int j = l + 1; j < r; ++j) {
+      if (comp(a[j], a[best])) best = j;
+    }
+    CAPTURE(n);
+    CAPTURE(l);
+    CAPTURE(r);
+    CHECK(rmq(l, r) == best);
+  }
+}
+}  // namespace succinct_rmq_test
+
+TEST_SUITE("Succinct RMQ Suite") {
+  using namespace succinct_rmq_test;
+
+  TEST_CASE("Empty Input") {
+    std::vector<int> none;
+    succinct_rmq rmq(none.begin(), none.end());
+    CHECK(rmq.size() == 0);
+  }
+
+  TEST_CASE("Basic Queries and Leftmost Ties") {
+    std::vector<int> a = {5, 2, 7, 8, 2, 9, 1, 1};
+    succinct_rmq rmq(a.begin(), a.end());
+
+    CHECK(rmq(0, 1) == 0);
+    CHECK(rmq(0, 6) == 1);
+    CHECK(rmq(2, 6) == 4);
+    CHECK(rmq(0, 8) == 6);
+    CHECK(rmq(7, 8) == 7);
+    CHECK(rmq.size() == 8);
+  }
+
+  TEST_CASE("Range Maximum with Custom Comparator") {
+    std::vector<int> a = {3, 10, 4, 10, 1};
+    succinct_rmq rmq(a.begin(), a.end(), std::greater<int>());
+    CHECK(rmq(0, 5) == 1);
+    CHECK(rmq(2, 5) == 3);
+  }
+
+  TEST_CASE("Construction from a Pointer Range") {
+    const int a[] = {6, 3, 8, 1, 9};
+    succinct_rmq rmq(a, a + 5);
+    CHECK(rmq(0, 3) == 1);
+    CHECK(rmq(2, 5) == 3);
+    CHECK(rmq(4, 5) == 4);
+  }
+
+  TEST_CASE("Monotone and Constant Inputs") {
+    const int n = 5000;
+    std::vector<int> inc(n), dec(n), same(n, 7);
+    for (int i = 0; i < n; ++i) inc[i] = i, dec[i] = n - i;
+
+    std::mt19937 rng(1);
+    check_brute_force(inc, 2000, rng);
+    check_brute_force(dec, 2000, rng);
+    check_brute_force(same, 2000, rng);
+  }
+
+  TEST_CASE("Long Pop Runs Reach Every Select Path") {
+    // Each ramp ends in a new global minimum that pops it whole: ramps of 70000 leave groups
+    // spanning more than 2^16 bits, and ramps of 5000 leave sparse runs inside dense groups
+    std::vector<int> a;
+    int low = 0;
+    for (int len : {70000, 3, 5000, 100, 4100, 1, 70000, 64, 5000, 2000, 9000}) {
+      --low;
+      for (int i = 0; i < len; ++i) a.push_back(low + 1 + i);
+      a.push_back(low);
+    }
+    std::mt19937 rng(4);
+    check_brute_force(a, 20000, rng);
+  }
+
+  TEST_CASE("Randomized Parity with Brute Force") {
+    std::mt19937 rng(11);
+    for (int n : {2, 63, 129, 1000, 20000}) {
+      for (int range : {3, 1000000}) {
+        std::vector<int> a(n);
+        for (int i = 0; i < n; ++i) a[i] = std::uniform_int_distribution<int>(0, range - 1)(rng);
+        check_brute_force(a, 3000, rng);
+        check_brute_force(a, 1000, rng, std::greater<int>());
+      }
+    }
+  }
+}
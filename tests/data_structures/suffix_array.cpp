@@ -0,0 +1,89 @@
+// =============================================================================
+// @author     Jose A. Romero (jromero132)
+// @unit_test  Suffix Array Test Suite
+// @docs       Validates SA-IS order and Kasai heights on hand-checked words,
+//             degenerate (empty, unary, periodic) strings, full byte range
+//             input, and randomized parity of `sa` and `lcp(i, j)` with naive
+//             suffix sorting and character-by-character comparison.
+// =============================================================================
+
+#include "../../code/data_structures/suffix_array.cpp"
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../doctest.h"
+
+namespace suffix_array_test {
+std::vector<int> naive_sa(const std::string& s) {
+  std::vector<int> sa(s.size());
+  for (int i = 0; i < static_cast<int>(s.size()); ++i) sa[i] = i;
+  std::sort(sa.begin(), sa.end(), [&s](int a, int b) { return s.substr(a) < s.substr(b); });
+  return sa;
+}
+
+int naive_lcp(const std::string& s, int i, int j) {
+  int h = 0;
+  while (i + h < static_cast<int>(s.size()) && j + h < static_cast<int>(s.size()) &&
+         s[i + h] == s[j + h])
+    ++h;
+  return h;
+}
+
+// Checks `sa` and every `lcp(i, j)` of `s` against the naive definitions
+void check_naive(const std::string& s) {
+  CAPTURE(s);
+  suffix_array sa(s);
+  CHECK(sa.sa == naive_sa(s));
+  for (int i = 0; i < static_cast<int>(s.size()); ++i) {
+    for (int j = 0; j < static_cast<int>(s.size()); ++j) {
+      CAPTURE(i);
+      CAPTURE(j);
+      CHECK(sa.lcp(i, j) == naive_lcp(s, i, j));
+    }
+  }
+}
+}  // namespace suffix_array_test
+
+TEST_SUITE("Suffix Array Suite") {
+  using namespace suffix_array_test;
+
+  TEST_CASE("Hand-Checked Word") {
+    suffix_array sa("mississippi");
+    CHECK(sa.sa == std::vector<int>({10, 7, 4, 1, 0, 9, 8, 6, 3, 5, 2}));
+    CHECK(sa.height == std::vector<int>({0, 1, 1, 4, 0, 0, 1, 0, 2, 1, 3}));
+    CHECK(sa.lcp(1, 4) == 4);  // "issi" shared by "ississippi" and "issippi"
+    CHECK(sa.lcp(2, 5) == 3);
+    CHECK(sa.lcp(0, 0) == 11);
+    CHECK(sa.lcp(0, 1) == 0);
+  }
+
+  TEST_CASE("Degenerate Strings") {
+    CHECK(suffix_array("").size() == 0);
+    check_naive("z");
+    check_naive("aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa");
+    check_naive("abababababababababababababababab");
+    check_naive("abcabcabcabcabcabcabcabcabcabcab");
+    check_naive("zyxwvutsrqponmlkjihgfedcba");
+  }
+
+  TEST_CASE("Full Byte Range") {
+    std::string s;
+    for (int c = 255; c >= 0; c -= 3) s += static_cast<char>(c), s += static_cast<char>(c ^ 1);
+    s += s;
+    check_naive(s);
+  }
+
+  TEST_CASE("Randomized Parity with Naive Sorting") {
+    std::mt19937 rng(17);
+    for (int iter = 0; iter < 200; ++iter) {
+      const int n = std::uniform_int_distribution<int>(1, 120)(rng);
+      std::uniform_int_distribution<int> letter(0, std::uniform_int_distribution<int>(0, 3)(rng));
+      std::string s(n, 'a');
+      for (char& c : s) c += letter(rng);
+      check_naive(s);
+    }
+  }
+}
@@ -7,10 +7,23 @@
 // =============================================================================
 
 #include "avl.cpp"
+#include "bloom_filter.cpp"
+#include "cartesian_tree.cpp"
+#include "dynamic_rmq.cpp"
 #include "fenwick.cpp"
+#include "hash_set.cpp"
 #include "hash_table.cpp"
+#include "lca.cpp"
+#include "lock_free_hash_table.cpp"
+#include "mo.cpp"
 #include "monotonic_queue.cpp"
 #include "order_statistic.cpp"
+#include "perfect_hash_table.cpp"
 #include "persistent_treap.cpp"
 #include "randomized_kd_tree.cpp"
+#include "range_distinct.cpp"
+#include "rmq_2d.cpp"
 #include "rmq_direct.cpp"
+#include "sparse_table.cpp"
+#include "succinct_rmq.cpp"
+#include "suffix_array.cpp"